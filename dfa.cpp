@@ -0,0 +1,627 @@
+#include <bitset>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <stdexcept>
+#include <cctype>
+
+#include "dfa.hpp"
+
+class RegexNode
+{
+    public:
+        enum RegexNodeType {
+            CHARACTERS,
+            CONCATENATION,
+            ALTERNATION,
+            REPETITION
+        } type;
+
+        std::bitset<256> characters;
+
+        std::vector<RegexNode> children;
+
+        int minCount = 0;
+        int maxCount = -1;
+
+        RegexNode(RegexNodeType type)
+        {
+            this->type = type;
+        };
+};
+
+class RegexParser
+{
+    private:
+        const std::string& pattern;
+        int position = 0;
+
+        [[noreturn]] void fail(const std::string reason) const
+        {
+            throw std::invalid_argument("regex \"" + this->pattern + "\" at char " + std::to_string(this->position + 1) + ": " + reason);
+        };
+
+        bool atEnd() const
+        {
+            return this->position == (int) this->pattern.size();
+        };
+
+        char peek() const
+        {
+            return this->pattern[this->position];
+        };
+
+        static std::bitset<256> range(const int first, const int last)
+        {
+            std::bitset<256> characters;
+
+            for (int c = first;c<=last;c++) characters.set(c);
+
+            return characters;
+        };
+
+        std::bitset<256> escape()
+        {
+            if (this->atEnd()) this->fail("dangling escape");
+
+            char c = this->pattern[this->position++];
+
+            std::bitset<256> digits = range('0', '9');
+            std::bitset<256> word = range('a', 'z') | range('A', 'Z') | digits;
+            std::bitset<256> space;
+
+            word.set('_');
+
+            for (char spaceChar : std::string(" \t\n\r\f\v")) space.set((unsigned char) spaceChar);
+
+            switch (c) {
+                case 'd': return digits;
+                case 'D': return ~digits;
+                case 'w': return word;
+                case 'W': return ~word;
+                case 's': return space;
+                case 'S': return ~space;
+                case 'n': return range('\n', '\n');
+                case 't': return range('\t', '\t');
+                case 'r': return range('\r', '\r');
+                default: return range((unsigned char) c, (unsigned char) c);
+            }
+        };
+
+        std::bitset<256> characterClass()
+        {
+            bool negated = !this->atEnd() && this->peek() == '^';
+
+            if (negated) this->position++;
+
+            std::bitset<256> characters;
+
+            bool first = true;
+
+            while (true) {
+                if (this->atEnd()) this->fail("unterminated character class");
+
+                char c = this->pattern[this->position++];
+
+                if (c == ']' && !first) break;
+
+                first = false;
+
+                if (c == '\\') {
+                    std::bitset<256> escaped = this->escape();
+
+                    if (escaped.count() != 1 || this->atEnd() || this->peek() != '-') {
+                        characters |= escaped;
+
+                        continue;
+                    }
+
+                    for (int i = 0;i<256;i++) if (escaped[i]) c = (char) i;
+                }
+
+                if (this->position + 1 < (int) this->pattern.size() && this->peek() == '-' && this->pattern[this->position + 1] != ']') {
+                    this->position++;
+
+                    char last = this->pattern[this->position++];
+
+                    if (last == '\\') {
+                        std::bitset<256> escaped = this->escape();
+
+                        if (escaped.count() != 1) this->fail("class range ends in a class");
+
+                        for (int i = 0;i<256;i++) if (escaped[i]) last = (char) i;
+                    }
+
+                    if ((unsigned char) last < (unsigned char) c) this->fail("reversed class range");
+
+                    characters |= range((unsigned char) c, (unsigned char) last);
+                }
+                else characters.set((unsigned char) c);
+            }
+
+            return negated ? ~characters : characters;
+        };
+
+        int count()
+        {
+            int value = 0;
+
+            if (this->atEnd() || !std::isdigit((unsigned char) this->peek())) this->fail("expected a repetition count");
+
+            while (!this->atEnd() && std::isdigit((unsigned char) this->peek())) {
+                value = value * 10 + (this->pattern[this->position++] - '0');
+
+                if (value > 1000) this->fail("repetition count too large");
+            }
+
+            return value;
+        };
+
+        RegexNode atom()
+        {
+            char c = this->pattern[this->position++];
+
+            RegexNode node(RegexNode::RegexNodeType::CHARACTERS);
+
+            if (c == '(') {
+                RegexNode group = this->alternation();
+
+                if (this->atEnd() || this->peek() != ')') this->fail("unbalanced parenthesis");
+
+                this->position++;
+
+                return group;
+            }
+
+            if (c == '[') node.characters = this->characterClass();
+
+            else if (c == '.') node.characters = ~range('\n', '\n');
+
+            else if (c == '\\') node.characters = this->escape();
+
+            else if (c == '*' || c == '+' || c == '?' || c == '{' || c == ')') {
+                this->position--;
+
+                this->fail("nothing to repeat");
+            }
+
+            else node.characters = range((unsigned char) c, (unsigned char) c);
+
+            return node;
+        };
+
+        RegexNode quantified()
+        {
+            RegexNode node = this->atom();
+
+            while (!this->atEnd()) {
+                char c = this->peek();
+
+                int minCount;
+                int maxCount;
+
+                if (c == '*') {
+                    minCount = 0;
+                    maxCount = -1;
+                }
+                else if (c == '+') {
+                    minCount = 1;
+                    maxCount = -1;
+                }
+                else if (c == '?') {
+                    minCount = 0;
+                    maxCount = 1;
+                }
+                else if (c == '{') {
+                    this->position++;
+
+                    minCount = this->count();
+                    maxCount = minCount;
+
+                    if (!this->atEnd() && this->peek() == ',') {
+                        this->position++;
+
+                        maxCount = !this->atEnd() && this->peek() == '}' ? -1 : this->count();
+                    }
+
+                    if (this->atEnd() || this->peek() != '}') this->fail("unterminated repetition count");
+
+                    if (maxCount != -1 && maxCount < minCount) this->fail("reversed repetition count");
+                }
+                else break;
+
+                this->position++;
+
+                RegexNode repetition(RegexNode::RegexNodeType::REPETITION);
+                repetition.minCount = minCount;
+                repetition.maxCount = maxCount;
+                repetition.children = { node };
+
+                node = repetition;
+            }
+
+            return node;
+        };
+
+        RegexNode concatenation()
+        {
+            RegexNode node(RegexNode::RegexNodeType::CONCATENATION);
+
+            while (!this->atEnd() && this->peek() != '|' && this->peek() != ')') node.children.push_back(this->quantified());
+
+            return node;
+        };
+
+        RegexNode alternation()
+        {
+            RegexNode node(RegexNode::RegexNodeType::ALTERNATION);
+
+            node.children.push_back(this->concatenation());
+
+            while (!this->atEnd() && this->peek() == '|') {
+                this->position++;
+
+                node.children.push_back(this->concatenation());
+            }
+
+            return node;
+        };
+
+    public:
+        RegexParser(const std::string& pattern) : pattern(pattern) {};
+
+        RegexNode parse()
+        {
+            RegexNode node = this->alternation();
+
+            if (!this->atEnd()) this->fail("unbalanced parenthesis");
+
+            return node;
+        };
+};
+
+// thompson construction, each state either consumes one of its characters into next or follows its epsilons
+
+class NFA
+{
+    public:
+        struct State {
+            std::bitset<256> characters;
+            int next = -1;
+            std::vector<int> epsilons;
+            int acceptingRule = -1;
+        };
+
+        std::vector<State> states;
+
+        int addState()
+        {
+            this->states.push_back(State());
+
+            return this->states.size() - 1;
+        };
+
+        // returns { entry, exit } of a fragment, exit has no outgoing transitions yet
+
+        std::pair<int, int> build(const RegexNode& node)
+        {
+            int entry = this->addState();
+
+            if (node.type == RegexNode::RegexNodeType::CHARACTERS) {
+                int exit = this->addState();
+
+                this->states[entry].characters = node.characters;
+                this->states[entry].next = exit;
+
+                return { entry, exit };
+            }
+
+            if (node.type == RegexNode::RegexNodeType::CONCATENATION) {
+                int exit = entry;
+
+                for (const RegexNode& child : node.children) {
+                    std::pair<int, int> fragment = this->build(child);
+
+                    this->states[exit].epsilons.push_back(fragment.first);
+
+                    exit = fragment.second;
+                }
+
+                return { entry, exit };
+            }
+
+            if (node.type == RegexNode::RegexNodeType::ALTERNATION) {
+                int exit = this->addState();
+
+                for (const RegexNode& child : node.children) {
+                    std::pair<int, int> fragment = this->build(child);
+
+                    this->states[entry].epsilons.push_back(fragment.first);
+                    this->states[fragment.second].epsilons.push_back(exit);
+                }
+
+                return { entry, exit };
+            }
+
+            int exit = entry;
+
+            for (int i = 0;i<node.minCount;i++) {
+                std::pair<int, int> fragment = this->build(node.children[0]);
+
+                this->states[exit].epsilons.push_back(fragment.first);
+
+                exit = fragment.second;
+            }
+
+            if (node.maxCount == -1) {
+                std::pair<int, int> fragment = this->build(node.children[0]);
+
+                int loopExit = this->addState();
+
+                this->states[exit].epsilons.push_back(fragment.first);
+                this->states[exit].epsilons.push_back(loopExit);
+                this->states[fragment.second].epsilons.push_back(fragment.first);
+                this->states[fragment.second].epsilons.push_back(loopExit);
+
+                return { entry, loopExit };
+            }
+
+            int optionalExit = this->addState();
+
+            for (int i = node.minCount;i<node.maxCount;i++) {
+                std::pair<int, int> fragment = this->build(node.children[0]);
+
+                this->states[exit].epsilons.push_back(fragment.first);
+                this->states[exit].epsilons.push_back(optionalExit);
+
+                exit = fragment.second;
+            }
+
+            this->states[exit].epsilons.push_back(optionalExit);
+
+            return { entry, optionalExit };
+        };
+
+        std::vector<int> closure(std::vector<int> stateSet) const
+        {
+            std::vector<bool> seen(this->states.size());
+            std::vector<int> pending = stateSet;
+
+            for (int state : stateSet) seen[state] = true;
+
+            while (!pending.empty()) {
+                int state = pending.back();
+
+                pending.pop_back();
+
+                for (int epsilon : this->states[state].epsilons) {
+                    if (seen[epsilon]) continue;
+
+                    seen[epsilon] = true;
+
+                    stateSet.push_back(epsilon);
+                    pending.push_back(epsilon);
+                }
+            }
+
+            std::sort(stateSet.begin(), stateSet.end());
+
+            return stateSet;
+        };
+};
+
+// moore partition refinement, states that accept the same rule and step into the same blocks merge
+// states that can never reach an accepting state fold into the implicit dead state
+
+DFA minimize(const DFA& dfa)
+{
+    int stateCount = dfa.acceptingRules.size();
+    int deadState = stateCount;
+
+    auto target = [&] (const int state, const int byteClass) -> int {
+        if (state == deadState) return deadState;
+
+        int next = dfa.transitions[state * dfa.classCount + byteClass];
+
+        return next == -1 ? deadState : next;
+    };
+
+    std::vector<int> blocks(stateCount + 1);
+
+    for (int state = 0;state<stateCount;state++) blocks[state] = dfa.acceptingRules[state] + 1;
+
+    blocks[deadState] = 0;
+
+    int blockCount = 0;
+
+    while (true) {
+        std::map<std::vector<int>, int> signatures;
+        std::vector<int> refinedBlocks(stateCount + 1);
+
+        for (int state = 0;state<=stateCount;state++) {
+            std::vector<int> signature = { blocks[state] };
+
+            for (int byteClass = 0;byteClass<dfa.classCount;byteClass++) signature.push_back(blocks[target(state, byteClass)]);
+
+            auto existingBlock = signatures.find(signature);
+
+            if (existingBlock == signatures.end()) existingBlock = signatures.insert({ signature, (int) signatures.size() }).first;
+
+            refinedBlocks[state] = existingBlock->second;
+        }
+
+        blocks = refinedBlocks;
+
+        if ((int) signatures.size() == blockCount) break;
+
+        blockCount = signatures.size();
+    }
+
+    // renumber so the start state stays 0 and the dead block disappears into -1
+
+    std::vector<int> renumbered(blockCount, -1);
+
+    int minimizedStateCount = 0;
+
+    renumbered[blocks[0]] = minimizedStateCount++;
+
+    for (int state = 1;state<stateCount;state++) if (blocks[state] != blocks[deadState] && renumbered[blocks[state]] == -1) renumbered[blocks[state]] = minimizedStateCount++;
+
+    if (blocks[0] == blocks[deadState]) minimizedStateCount = 1;
+
+    DFA minimized;
+
+    minimized.byteClasses = dfa.byteClasses;
+    minimized.classCount = dfa.classCount;
+    minimized.acceptingRules.assign(minimizedStateCount, -1);
+    minimized.transitions.assign(minimizedStateCount * dfa.classCount, -1);
+
+    for (int state = 0;state<stateCount;state++) {
+        int minimizedState = renumbered[blocks[state]];
+
+        if (blocks[state] == blocks[deadState] && state != 0) continue;
+
+        minimized.acceptingRules[minimizedState] = dfa.acceptingRules[state];
+
+        for (int byteClass = 0;byteClass<dfa.classCount;byteClass++) {
+            int next = target(state, byteClass);
+
+            if (blocks[next] != blocks[deadState]) minimized.transitions[minimizedState * dfa.classCount + byteClass] = renumbered[blocks[next]];
+        }
+    }
+
+    minimized.liveStates.assign(minimizedStateCount, false);
+
+    for (int state = 0;state<minimizedStateCount;state++) {
+        for (int byteClass = 0;byteClass<dfa.classCount;byteClass++) {
+            if (minimized.transitions[state * dfa.classCount + byteClass] != -1) minimized.liveStates[state] = true;
+        }
+    }
+
+    return minimized;
+};
+
+DFA DFA::compile(const std::vector<std::string> patterns)
+{
+    NFA nfa;
+
+    int nfaStart = nfa.addState();
+
+    for (int rule = 0;rule<(int)patterns.size();rule++) {
+        std::pair<int, int> fragment = nfa.build(RegexParser(patterns[rule]).parse());
+
+        nfa.states[nfaStart].epsilons.push_back(fragment.first);
+        nfa.states[fragment.second].acceptingRule = rule;
+    }
+
+    DFA dfa;
+
+    // bytes no pattern tells apart share a column of the transition table
+
+    std::map<std::vector<bool>, int> classSignatures;
+
+    for (int c = 0;c<256;c++) {
+        std::vector<bool> signature;
+
+        for (const NFA::State& state : nfa.states) if (state.next != -1) signature.push_back(state.characters[c]);
+
+        auto existingClass = classSignatures.find(signature);
+
+        if (existingClass == classSignatures.end()) existingClass = classSignatures.insert({ signature, (int) classSignatures.size() }).first;
+
+        dfa.byteClasses[c] = existingClass->second;
+    }
+
+    dfa.classCount = classSignatures.size();
+
+    std::vector<int> classRepresentatives(dfa.classCount);
+
+    for (int c = 255;c>=0;c--) classRepresentatives[dfa.byteClasses[c]] = c;
+
+    std::map<std::vector<int>, int> dfaStates;
+    std::vector<std::vector<int>> pendingStateSets;
+
+    auto addStateSet = [&] (const std::vector<int>& stateSet) -> int {
+        auto existingState = dfaStates.find(stateSet);
+
+        if (existingState != dfaStates.end()) return existingState->second;
+
+        int dfaState = dfaStates.size();
+
+        dfaStates.insert({ stateSet, dfaState });
+
+        int acceptingRule = -1;
+
+        for (int state : stateSet) {
+            int rule = nfa.states[state].acceptingRule;
+
+            if (rule != -1 && (acceptingRule == -1 || rule < acceptingRule)) acceptingRule = rule;
+        }
+
+        dfa.acceptingRules.push_back(acceptingRule);
+        dfa.transitions.resize(dfa.transitions.size() + dfa.classCount, -1);
+
+        pendingStateSets.push_back(stateSet);
+
+        return dfaState;
+    };
+
+    addStateSet(nfa.closure({ nfaStart }));
+
+    for (int dfaState = 0;dfaState<(int)pendingStateSets.size();dfaState++) {
+        for (int byteClass = 0;byteClass<dfa.classCount;byteClass++) {
+            int c = classRepresentatives[byteClass];
+
+            std::vector<int> nextStateSet;
+
+            for (int state : pendingStateSets[dfaState]) {
+                if (nfa.states[state].next != -1 && nfa.states[state].characters[c]) nextStateSet.push_back(nfa.states[state].next);
+            }
+
+            if (nextStateSet.empty()) continue;
+
+            int nextDfaState = addStateSet(nfa.closure(nextStateSet));
+
+            dfa.transitions[dfaState * dfa.classCount + byteClass] = nextDfaState;
+        }
+    }
+
+    return minimize(dfa);
+};
+
+int DFA::match(const std::string& str, const int start, int& rule) const
+{
+    bool reachedEnd;
+
+    return this->match(str, start, rule, reachedEnd);
+};
+
+int DFA::match(const std::string& str, const int start, int& rule, bool& reachedEnd) const
+{
+    int state = 0;
+    int longestMatch = -1;
+
+    if (this->acceptingRules[0] != -1) {
+        longestMatch = 0;
+        rule = this->acceptingRules[0];
+    }
+
+    for (int i = start;i<(int)str.size();i++) {
+        state = this->transitions[state * this->classCount + this->byteClasses[(unsigned char) str[i]]];
+
+        if (state == -1) {
+            reachedEnd = false;
+
+            return longestMatch;
+        }
+
+        if (this->acceptingRules[state] != -1) {
+            longestMatch = i + 1 - start;
+            rule = this->acceptingRules[state];
+        }
+    }
+
+    reachedEnd = this->liveStates[state];
+
+    return longestMatch;
+};
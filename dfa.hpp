@@ -0,0 +1,35 @@
+#ifndef DFA_HPP
+#define DFA_HPP
+
+#include <string>
+#include <vector>
+#include <array>
+
+// byte level automaton compiled from a regular language subset:
+// literals, escapes (\d \w \s and their negations, \n \t \r), ., [...] / [^...] classes, (...), |, *, +, ?, {m}, {m,}, {m,n}
+
+class DFA
+{
+    public:
+        std::array<int, 256> byteClasses;
+        int classCount = 0;
+
+        std::vector<int> transitions;
+        std::vector<int> acceptingRules;
+
+        // whether any byte leads on from a state, running out of input anywhere else could not have matched longer
+
+        std::vector<bool> liveStates;
+
+        DFA() = default;
+
+        static DFA compile(const std::vector<std::string> patterns);
+
+        int match(const std::string& str, const int start, int& rule) const;
+
+        // also tells whether the walk ran out of input while a longer match was still possible
+
+        int match(const std::string& str, const int start, int& rule, bool& reachedEnd) const;
+};
+
+#endif
@@ -0,0 +1,14 @@
+#include <iostream>
+
+#include "generator.hpp"
+#include "grammars.hpp"
+
+int main()
+{
+    std::cout << generateParsers({
+        { "parseSimpleLanguageGenerated", simpleLanguageGrammar() },
+        { "parseXmlGenerated", xmlGrammar() }
+    });
+
+    return 0;
+};
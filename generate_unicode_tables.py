@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+
+# writes unicode_tables.hpp, the general category of every code point from the character database python ships with
+# usage: python3 generate_unicode_tables.py > unicode_tables.hpp
+
+import unicodedata
+
+# in the order of UnicodeCategory
+CATEGORIES = [
+    "Lu", "Ll", "Lt", "Lm", "Lo",
+    "Mn", "Mc", "Me",
+    "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po",
+    "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp",
+    "Cc", "Cf", "Cs", "Co", "Cn"
+]
+
+CODE_POINTS = 0x110000
+
+
+def split(values, size):
+    # deduplicated blocks of the given size and the index of each block
+    blocks = {}
+    indices = []
+
+    for start in range(0, len(values), size):
+        indices.append(blocks.setdefault(tuple(values[start:start + size]), len(blocks)))
+
+    return list(blocks), indices
+
+
+def element_type(values):
+    return "uint8_t" if max(values) < 256 else "uint16_t"
+
+
+def element_size(values):
+    return 1 if max(values) < 256 else 2
+
+
+def array(name, values):
+    lines = []
+
+    for start in range(0, len(values), 32):
+        lines.append("    " + ",".join(str(value) for value in values[start:start + 32]))
+
+    return "static const %s %s[%d] = {\n%s\n};\n" % (element_type(values), name, len(values), ",\n".join(lines))
+
+
+def main():
+    categories = [CATEGORIES.index(unicodedata.category(chr(code_point))) for code_point in range(CODE_POINTS)]
+
+    # three stages, the shifts are whichever pair gives the smallest tables
+    best = None
+
+    for block_shift in range(4, 8):
+        blocks, block_indices = split(categories, 1 << block_shift)
+
+        for row_shift in range(3, 8):
+            rows, row_indices = split(block_indices, 1 << row_shift)
+
+            size = len(row_indices) * element_size(row_indices) + len(rows) * (1 << row_shift) * element_size(block_indices) + len(blocks) * (1 << block_shift)
+
+            if best is None or size < best[0]:
+                best = (size, block_shift, row_shift, blocks, rows, row_indices)
+
+    size, block_shift, row_shift, blocks, rows, row_indices = best
+
+    print("// generated by generate_unicode_tables.py from the Unicode %s character database, do not edit" % unicodedata.unidata_version)
+    print()
+    print("#ifndef UNICODE_TABLES_HPP")
+    print("#define UNICODE_TABLES_HPP")
+    print()
+    print("#include <cstdint>")
+    print()
+    print("// %d bytes, a code point picks a row with its top bits, a block from the row with the next %d bits and its category from the block with the low %d bits" % (size, row_shift, block_shift))
+    print()
+    print("const int unicodeBlockShift = %d;" % block_shift)
+    print("const int unicodeRowShift = %d;" % row_shift)
+    print()
+    print(array("unicodeCategoryRows", row_indices))
+    print(array("unicodeCategoryBlockIndices", [index for row in rows for index in row]))
+    print(array("unicodeCategoryBlocks", [category for block in blocks for category in block]))
+    print("#endif")
+
+
+main()
@@ -0,0 +1,613 @@
+#include <map>
+#include <deque>
+#include <sstream>
+#include <stdexcept>
+#include <limits>
+#include <set>
+
+#include "generator.hpp"
+#include "dfa.hpp"
+#include "unicode.hpp"
+
+std::string cStringLiteral(const std::string& str)
+{
+    std::string literal = "\"";
+
+    for (const char& c : str) {
+        unsigned char byte = c;
+
+        if (c == '"' || c == '\\') literal += std::string("\\") + c;
+
+        else if (byte >= 0x20 && byte < 0x7f && c != '?') literal += c;
+
+        else {
+            const char* digits = "01234567";
+
+            literal += std::string("\\") + digits[byte >> 6] + digits[(byte >> 3) & 7] + digits[byte & 7];
+        }
+    }
+
+    return literal + "\"";
+};
+
+std::string stringExpression(const std::string& str)
+{
+    return "std::string(" + cStringLiteral(str) + ", " + std::to_string(str.size()) + ")";
+};
+
+std::bitset<256> tabulate(const Predicate& predicate)
+{
+    const CharacterClass* characterClass = predicate.target<CharacterClass>();
+
+    if (characterClass != nullptr) return characterClass->members;
+
+    std::bitset<256> members;
+
+    for (int c = 0;c<256;c++) if (predicate((char) c)) members.set(c);
+
+    return members;
+};
+
+std::vector<std::pair<int, int>> characterRanges(const std::bitset<256>& members)
+{
+    std::vector<std::pair<int, int>> ranges;
+
+    for (int c = 0;c<256;c++) {
+        if (!members[c]) continue;
+
+        if (!ranges.empty() && ranges.back().second == c - 1) ranges.back().second = c;
+
+        else ranges.push_back({ c, c });
+    }
+
+    return ranges;
+};
+
+int countRanges(const std::bitset<256>& members)
+{
+    return characterRanges(members).size();
+};
+
+// the code points a predicate accepts as inclusive ranges, surrogates are never decoded so they join whichever ranges surround them
+
+std::vector<std::pair<char32_t, char32_t>> codePointRanges(const CodePointClass& codePointClass)
+{
+    std::vector<std::pair<char32_t, char32_t>> ranges;
+
+    for (char32_t codePoint = 0;codePoint<0x110000;codePoint++) {
+        bool surrogate = codePoint >= 0xD800 && codePoint <= 0xDFFF;
+
+        if (!surrogate && !codePointClass.contains(codePoint)) continue;
+
+        if (!ranges.empty() && ranges.back().second == codePoint - 1) ranges.back().second = codePoint;
+
+        else if (!surrogate) ranges.push_back({ codePoint, codePoint });
+    }
+
+    return ranges;
+};
+
+class ParserGenerator
+{
+    private:
+        std::string prefix;
+
+        std::map<const GrammarNode*, int> ruleIndices;
+        std::map<const ParserCombinator*, ParserCombinator> optimizedProxyTargets;
+        std::deque<const GrammarNode*> pendingRules;
+
+        std::ostringstream declarations;
+        std::ostringstream definitions;
+
+        bool usesSkipper = false;
+        bool usesCodePoints = false;
+        bool usesCodePointRanges = false;
+
+        static bool containsSkipping(const ParserCombinator& parserCombinator, std::set<const GrammarNode*>& visited)
+        {
+            const GrammarNode* grammarNode = parserCombinator.getGrammarNode();
+
+            if (grammarNode == nullptr || !visited.insert(grammarNode).second) return false;
+
+            if (grammarNode->type == GrammarNode::GrammarNodeType::SKIPPING) return true;
+
+            if (grammarNode->type == GrammarNode::GrammarNodeType::PROXY) return containsSkipping(*grammarNode->proxiedParserCombinator, visited);
+
+            for (const ParserCombinator& child : grammarNode->children) if (containsSkipping(child, visited)) return true;
+
+            return false;
+        };
+
+        // width of the trivia a leaf consumes after itself, only emitted when some grammar in the file skips
+
+        std::string trailingTrivia(const std::string& position) const
+        {
+            return this->usesSkipper ? " + skipGeneratedTrivia(str, " + position + ")" : "";
+        };
+
+        std::string ruleName(const GrammarNode* grammarNode)
+        {
+            auto existingRule = this->ruleIndices.find(grammarNode);
+
+            if (existingRule != this->ruleIndices.end()) return this->prefix + "Rule" + std::to_string(existingRule->second);
+
+            int ruleIndex = this->ruleIndices.size();
+
+            this->ruleIndices.insert({ grammarNode, ruleIndex });
+
+            this->pendingRules.push_back(grammarNode);
+
+            std::string name = this->prefix + "Rule" + std::to_string(ruleIndex);
+
+            this->declarations << "static ParserCombinatorResult " << name << "(const std::string& str, const int start);\n";
+
+            return name;
+        };
+
+        std::string ruleName(const ParserCombinator& parserCombinator)
+        {
+            const GrammarNode* grammarNode = parserCombinator.getGrammarNode();
+
+            if (grammarNode == nullptr) throw std::invalid_argument("cannot generate a parser for an unassigned combinator");
+
+            if (grammarNode->type != GrammarNode::GrammarNodeType::PROXY) return this->ruleName(grammarNode);
+
+            // call straight into the proxied rule, optimized once per target
+
+            const ParserCombinator* proxiedParserCombinator = grammarNode->proxiedParserCombinator;
+
+            auto optimizedTarget = this->optimizedProxyTargets.find(proxiedParserCombinator);
+
+            if (optimizedTarget == this->optimizedProxyTargets.end()) {
+                optimizedTarget = this->optimizedProxyTargets.insert({ proxiedParserCombinator, optimize(*proxiedParserCombinator) }).first;
+            }
+
+            return this->ruleName(optimizedTarget->second);
+        };
+
+        std::string characterTest(const std::bitset<256>& members, const int ruleIndex)
+        {
+            if (members.none()) return "false";
+
+            if (members.all()) return "true";
+
+            std::vector<std::pair<int, int>> ranges = characterRanges(members);
+
+            // a class like negate(is('"')) reads better and branches less as the complement of its few gaps
+
+            if (ranges.size() > 4 && countRanges(~members) <= 4) return "!(" + this->characterTest(~members, ruleIndex) + ")";
+
+            if (ranges.size() > 4) {
+                std::string tableName = this->prefix + "Class" + std::to_string(ruleIndex);
+
+                this->declarations << "static const bool " << tableName << "[256] = {";
+
+                for (int c = 0;c<256;c++) this->declarations << (c == 0 ? "" : ",") << (members[c] ? "1" : "0");
+
+                this->declarations << "};\n";
+
+                return tableName + "[c]";
+            }
+
+            std::string test;
+
+            for (const std::pair<int, int>& range : ranges) {
+                if (!test.empty()) test += " || ";
+
+                if (range.first == range.second) test += "c == " + std::to_string(range.first);
+
+                else if (range.first == 0) test += "c <= " + std::to_string(range.second);
+
+                else if (range.second == 255) test += "c >= " + std::to_string(range.first);
+
+                else test += "(c >= " + std::to_string(range.first) + " && c <= " + std::to_string(range.second) + ")";
+            }
+
+            return test;
+        };
+
+        std::string codePointTest(const CodePointClass& codePointClass, const int ruleIndex)
+        {
+            std::vector<std::pair<char32_t, char32_t>> ranges = codePointRanges(codePointClass);
+
+            if (ranges.empty()) return "false";
+
+            if (ranges.size() > 4) {
+                std::string tableName = this->prefix + "CodePoints" + std::to_string(ruleIndex);
+
+                this->declarations << "static const char32_t " << tableName << "[" << ranges.size() << "][2] = {";
+
+                for (int i = 0;i<(int)ranges.size();i++) this->declarations << (i == 0 ? "" : ",") << "{" << ranges[i].first << "," << ranges[i].second << "}";
+
+                this->declarations << "};\n";
+
+                this->usesCodePointRanges = true;
+
+                return "inGeneratedCodePointRanges(" + tableName + ", " + std::to_string(ranges.size()) + ", codePoint)";
+            }
+
+            std::string test;
+
+            for (const std::pair<char32_t, char32_t>& range : ranges) {
+                if (!test.empty()) test += " || ";
+
+                if (range.first == range.second) test += "codePoint == " + std::to_string(range.first);
+
+                else if (range.first == 0) test += "codePoint <= " + std::to_string(range.second);
+
+                else test += "(codePoint >= " + std::to_string(range.first) + " && codePoint <= " + std::to_string(range.second) + ")";
+            }
+
+            return test;
+        };
+
+        void generateRegex(const GrammarNode* grammarNode, const int ruleIndex)
+        {
+            DFA dfa = DFA::compile({ grammarNode->stringLiteral });
+
+            std::string tableName = this->prefix + "Regex" + std::to_string(ruleIndex);
+
+            this->declarations << "static const int " << tableName << "Classes[256] = {";
+
+            for (int c = 0;c<256;c++) this->declarations << (c == 0 ? "" : ",") << dfa.byteClasses[c];
+
+            this->declarations << "};\nstatic const int " << tableName << "Transitions[" << dfa.transitions.size() << "] = {";
+
+            for (int i = 0;i<(int)dfa.transitions.size();i++) this->declarations << (i == 0 ? "" : ",") << dfa.transitions[i];
+
+            this->declarations << "};\nstatic const bool " << tableName << "Accepting[" << dfa.acceptingRules.size() << "] = {";
+
+            for (int i = 0;i<(int)dfa.acceptingRules.size();i++) this->declarations << (i == 0 ? "" : ",") << (dfa.acceptingRules[i] != -1 ? "1" : "0");
+
+            this->declarations << "};\n";
+
+            std::ostringstream& out = this->definitions;
+
+            out << "    int state = 0;\n";
+            out << "    int longestMatch = " << (dfa.acceptingRules[0] != -1 ? "0" : "-1") << ";\n\n";
+            out << "    for (int i = start;i<(int)str.size();i++) {\n";
+            out << "        state = " << tableName << "Transitions[state * " << dfa.classCount << " + " << tableName << "Classes[(unsigned char) str[i]]];\n\n";
+            out << "        if (state == -1) break;\n\n";
+            out << "        if (" << tableName << "Accepting[state]) longestMatch = i + 1 - start;\n";
+            out << "    }\n\n";
+            out << "    if (longestMatch == -1) return ParserFailure(start);\n\n";
+            out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", str.substr(start, longestMatch), start, longestMatch" << this->trailingTrivia("start + longestMatch") << ");\n";
+        };
+
+        void generateRepetition(const GrammarNode* grammarNode, const bool strict)
+        {
+            std::string nestedRule = this->ruleName(grammarNode->children[0]);
+
+            std::ostringstream& out = this->definitions;
+
+            out << "    std::vector<Token> nestedTokens;\n\n";
+            out << "    int tokensFound = 0;\n\n";
+            out << "    int scanStart = start;\n\n";
+            out << "    while (scanStart != (int) str.size()) {\n";
+
+            if (grammarNode->maxCount != std::numeric_limits<int>::max()) out << "        if (tokensFound == " << grammarNode->maxCount << ") break;\n\n";
+
+            out << "        ParserCombinatorResult result = " << nestedRule << "(str, scanStart);\n\n";
+            out << "        if (!std::holds_alternative<Token>(result)) " << (strict ? "return result" : "break") << ";\n\n";
+            out << "        Token& token = std::get<Token>(result);\n\n";
+            out << "        if (token.width == 0) " << (strict ? "return ParserFailure(scanStart)" : "break") << ";\n\n";
+            out << "        tokensFound++;\n\n";
+            out << "        scanStart += token.width;\n\n";
+            out << "        addGeneratedChildToken(nestedTokens, std::move(token));\n";
+            out << "    }\n\n";
+
+            if (strict) out << "    if (scanStart != (int) str.size()) return " << nestedRule << "(str, scanStart);\n\n";
+
+            if (grammarNode->minCount > 0) out << "    if (tokensFound < " << grammarNode->minCount << ") return ParserFailure(scanStart);\n\n";
+
+            out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", std::move(nestedTokens), start, scanStart - start);\n";
+        };
+
+        void generateSequence(const GrammarNode* grammarNode, const bool strict)
+        {
+            std::ostringstream& out = this->definitions;
+
+            out << "    std::vector<Token> sequenceTokens;\n\n";
+            out << "    int scanOffset = 0;\n\n";
+
+            for (const ParserCombinator& child : grammarNode->children) {
+                out << "    {\n";
+                out << "        ParserCombinatorResult result = " << this->ruleName(child) << "(str, start + scanOffset);\n\n";
+                out << "        if (!std::holds_alternative<Token>(result)) return result;\n\n";
+                out << "        Token& token = std::get<Token>(result);\n\n";
+                out << "        scanOffset += token.width;\n\n";
+                out << "        addGeneratedChildToken(sequenceTokens, std::move(token));\n";
+                out << "    }\n\n";
+            }
+
+            if (strict) out << "    if (start + scanOffset != (int) str.size()) return ParserFailure(start + scanOffset, \"end of input\");\n\n";
+
+            out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", std::move(sequenceTokens), start, scanOffset);\n";
+        };
+
+        void generateChoice(const GrammarNode* grammarNode)
+        {
+            std::ostringstream& out = this->definitions;
+
+            if (grammarNode->children.empty()) {
+                out << "    return ParserFailure(start);\n";
+
+                return;
+            }
+
+            out << "    bool foundToken = false;\n";
+            out << "    std::vector<ParserFailure> parseFailures;\n";
+            out << "    Token bestToken;\n\n";
+
+            for (const ParserCombinator& child : grammarNode->children) {
+                out << "    {\n";
+                out << "        ParserCombinatorResult result = " << this->ruleName(child) << "(str, start);\n\n";
+                out << "        if (std::holds_alternative<Token>(result)) {\n";
+                out << "            Token& token = std::get<Token>(result);\n\n";
+                out << "            if (!foundToken || token.width > bestToken.width) {\n";
+                out << "                foundToken = true;\n\n";
+                out << "                bestToken = std::move(token);\n";
+                out << "            }\n";
+                out << "        }\n";
+                out << "        else if (!foundToken) {\n";
+                out << "            ParserFailure& parseFailure = std::get<ParserFailure>(result);\n\n";
+                out << "            if (parseFailures.empty() || parseFailure.start > parseFailures[0].start) parseFailures = { parseFailure };\n\n";
+                out << "            else if (parseFailure.start == parseFailures[0].start) parseFailures.push_back(parseFailure);\n";
+                out << "        }\n";
+                out << "    }\n\n";
+            }
+
+            out << "    if (foundToken) return bestToken;\n\n";
+            out << "    return ParserFailure::composeFrom(parseFailures);\n";
+        };
+
+        void generateRule(const GrammarNode* grammarNode)
+        {
+            int ruleIndex = this->ruleIndices.at(grammarNode);
+
+            std::ostringstream& out = this->definitions;
+
+            out << "\nstatic ParserCombinatorResult " << this->prefix << "Rule" << ruleIndex << "(const std::string& str, const int start)\n{\n";
+
+            switch (grammarNode->type) {
+                case GrammarNode::GrammarNodeType::SATISFY:
+                    out << "    const unsigned char c = str[start];\n\n";
+
+                    if (!tabulate(grammarNode->predicate).all()) out << "    if (!(" << this->characterTest(tabulate(grammarNode->predicate), ruleIndex) << ")) return ParserFailure(start);\n\n";
+
+                    out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", std::string(1, (char) c), start, 1" << this->trailingTrivia("start + 1") << ");\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::CODE_POINT:
+                    this->usesCodePoints = true;
+
+                    out << "    char32_t codePoint;\n\n";
+                    out << "    const int width = decodeUtf8(str, start, codePoint);\n\n";
+                    out << "    if (width == 0 || !(" << this->codePointTest(*grammarNode->codePointClass, ruleIndex) << ")) return ParserFailure(start);\n\n";
+                    out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", str.substr(start, width), start, width" << this->trailingTrivia("start + width") << ");\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::STRING:
+                    out << "    if (str.compare(start, " << grammarNode->stringLiteral.size() << ", " << cStringLiteral(grammarNode->stringLiteral) << ", " << grammarNode->stringLiteral.size() << ") != 0) return ParserFailure(start);\n\n";
+                    out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", " << stringExpression(grammarNode->stringLiteral) << ", start, " << grammarNode->stringLiteral.size() << this->trailingTrivia("start + " + std::to_string(grammarNode->stringLiteral.size())) << ");\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::LITERAL: {
+                    const std::string& stringLiteral = grammarNode->stringLiteral;
+
+                    out << "    int scanStart = start;\n\n";
+
+                    for (int segment = 0;segment<(int)grammarNode->segmentStarts.size();segment++) {
+                        int segmentStart = grammarNode->segmentStarts[segment];
+                        int segmentEnd = segment + 1 < (int) grammarNode->segmentStarts.size() ? grammarNode->segmentStarts[segment + 1] : stringLiteral.size();
+
+                        for (int i = segmentStart;i<segmentEnd;i++) {
+                            out << "    if (scanStart + " << i - segmentStart << " >= (int) str.size() || str[scanStart + " << i - segmentStart << "] != (char) " << (int) (unsigned char) stringLiteral[i] << ") return ParserFailure(scanStart);\n";
+                        }
+
+                        out << "\n    scanStart += " << segmentEnd - segmentStart << this->trailingTrivia("scanStart + " + std::to_string(segmentEnd - segmentStart)) << ";\n\n";
+                    }
+
+                    out << "    return Token(\"\", " << stringExpression(stringLiteral) << ", start, scanStart - start);\n";
+
+                    break;
+                }
+                case GrammarNode::GrammarNodeType::REGEX:
+                    this->generateRegex(grammarNode, ruleIndex);
+
+                    break;
+                case GrammarNode::GrammarNodeType::REPETITION:
+                    this->generateRepetition(grammarNode, false);
+
+                    break;
+                case GrammarNode::GrammarNodeType::STRICTLY_REPETITION:
+                    this->generateRepetition(grammarNode, true);
+
+                    break;
+                case GrammarNode::GrammarNodeType::SEQUENCE:
+                    this->generateSequence(grammarNode, false);
+
+                    break;
+                case GrammarNode::GrammarNodeType::STRICTLY_SEQUENCE:
+                    this->generateSequence(grammarNode, true);
+
+                    break;
+                case GrammarNode::GrammarNodeType::NEGATE:
+                    out << "    if (std::holds_alternative<Token>(" << this->ruleName(grammarNode->children[0]) << "(str, start))) return ParserFailure(start);\n\n";
+                    out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", std::vector<Token>(), start, 0);\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::CHOICE:
+                case GrammarNode::GrammarNodeType::CHOICE_CONCURRENT:
+                    this->generateChoice(grammarNode);
+
+                    break;
+                case GrammarNode::GrammarNodeType::ALL_OF:
+                    out << "    std::vector<Token> tokens;\n";
+                    out << "    int largestTokenWidth = 0;\n\n";
+
+                    for (const ParserCombinator& child : grammarNode->children) {
+                        out << "    {\n";
+                        out << "        ParserCombinatorResult result = " << this->ruleName(child) << "(str, start);\n\n";
+                        out << "        if (!std::holds_alternative<Token>(result)) return result;\n\n";
+                        out << "        Token& token = std::get<Token>(result);\n\n";
+                        out << "        if (token.width > largestTokenWidth) largestTokenWidth = token.width;\n\n";
+                        out << "        addGeneratedChildToken(tokens, std::move(token));\n";
+                        out << "    }\n\n";
+                    }
+
+                    out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", std::move(tokens), start, largestTokenWidth);\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::NONE_OF:
+                    for (const ParserCombinator& child : grammarNode->children) {
+                        out << "    if (std::holds_alternative<Token>(" << this->ruleName(child) << "(str, start))) return ParserFailure(start);\n\n";
+                    }
+
+                    out << "    return Token(\"\", std::vector<Token>(), start, 0);\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::NAMED:
+                    out << "    ParserCombinatorResult result = " << this->ruleName(grammarNode->children[0]) << "(str, start);\n\n";
+                    out << "    if (std::holds_alternative<Token>(result)) return result;\n\n";
+                    out << "    const ParserFailure& defaultParserFailure = std::get<ParserFailure>(result);\n\n";
+                    out << "    return ParserFailure(defaultParserFailure.start, defaultParserFailure.name.empty() ? " << stringExpression(grammarNode->name) << " : defaultParserFailure.name);\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::SKIPPING:
+                    out << "    GeneratedRule previousTrivia = generatedTrivia;\n\n";
+                    out << "    generatedTrivia = " << this->ruleName(grammarNode->children[0]) << ";\n\n";
+                    out << "    int leadingWidth = skipGeneratedTrivia(str, start);\n\n";
+                    out << "    ParserCombinatorResult result = " << this->ruleName(grammarNode->children[1]) << "(str, start + leadingWidth);\n\n";
+                    out << "    generatedTrivia = previousTrivia;\n\n";
+                    out << "    if (!std::holds_alternative<Token>(result)) return result;\n\n";
+                    out << "    Token& token = std::get<Token>(result);\n\n";
+                    out << "    token.start = start;\n";
+                    out << "    token.width += leadingWidth;\n\n";
+                    out << "    return result;\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::LEXEME:
+                    out << "    GeneratedRule previousTrivia = generatedTrivia;\n\n";
+                    out << "    generatedTrivia = nullptr;\n\n";
+                    out << "    ParserCombinatorResult result = " << this->ruleName(grammarNode->children[0]) << "(str, start);\n\n";
+                    out << "    generatedTrivia = previousTrivia;\n\n";
+                    out << "    if (!std::holds_alternative<Token>(result)) return result;\n\n";
+                    out << "    Token& token = std::get<Token>(result);\n\n";
+                    out << "    token.width += skipGeneratedTrivia(str, start + token.width);\n\n";
+                    out << "    return result;\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::SPAN:
+                    if (this->usesSkipper) out << "    GeneratedRule previousTrivia = generatedTrivia;\n\n    generatedTrivia = nullptr;\n\n";
+
+                    out << "    ParserCombinatorResult result = " << this->ruleName(grammarNode->children[0]) << "(str, start);\n\n";
+
+                    if (this->usesSkipper) out << "    generatedTrivia = previousTrivia;\n\n";
+
+                    out << "    if (!std::holds_alternative<Token>(result)) return result;\n\n";
+                    out << "    int width = std::get<Token>(result).width;\n\n";
+                    out << "    return Token(" << cStringLiteral(grammarNode->tokenId) << ", str.substr(start, width), start, width" << this->trailingTrivia("start + width") << ");\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::DISCARDED:
+                    out << "    ParserCombinatorResult result = " << this->ruleName(grammarNode->children[0]) << "(str, start);\n\n";
+                    out << "    if (!std::holds_alternative<Token>(result)) return result;\n\n";
+                    out << "    return Token(\"\", std::vector<Token>(), start, std::get<Token>(result).width);\n";
+
+                    break;
+                case GrammarNode::GrammarNodeType::RECOVERABLE:
+                    // generated parsers never run with recovery, where recoverable is just its item
+
+                    out << "    return " << this->ruleName(grammarNode->children[0]) << "(str, start);\n";
+
+                    break;
+                default:
+                    throw std::invalid_argument("cannot generate a parser for an opaque combinator");
+            }
+
+            out << "}\n";
+        };
+
+    public:
+        std::string generate(const std::vector<std::pair<std::string, ParserCombinator>>& namedParserCombinators)
+        {
+            std::ostringstream entryPoints;
+
+            std::set<const GrammarNode*> visited;
+
+            for (const std::pair<std::string, ParserCombinator>& namedParserCombinator : namedParserCombinators) {
+                if (containsSkipping(namedParserCombinator.second, visited)) this->usesSkipper = true;
+            }
+
+            for (const std::pair<std::string, ParserCombinator>& namedParserCombinator : namedParserCombinators) {
+                this->prefix = namedParserCombinator.first;
+
+                this->ruleIndices.clear();
+                this->optimizedProxyTargets.clear();
+
+                ParserCombinator optimizedParserCombinator = optimize(namedParserCombinator.second);
+
+                std::string rootRule = this->ruleName(optimizedParserCombinator);
+
+                while (!this->pendingRules.empty()) {
+                    const GrammarNode* grammarNode = this->pendingRules.front();
+
+                    this->pendingRules.pop_front();
+
+                    this->generateRule(grammarNode);
+                }
+
+                entryPoints << "\nParserCombinatorResult " << namedParserCombinator.first << "(const std::string& str)\n{\n";
+                entryPoints << "    return " << rootRule << "(str, 0);\n}\n";
+            }
+
+            std::string preamble =
+                "// generated by generateParsers, do not edit\n\n"
+                "#include <string>\n"
+                "#include <vector>\n"
+                "#include <variant>\n\n"
+                "#include \"parser.hpp\"\n" +
+                std::string(this->usesCodePoints ? "#include \"unicode.hpp\"\n" : "") + "\n"
+                "static inline void addGeneratedChildToken(std::vector<Token>& parent, Token&& token)\n{\n"
+                "    if (!token.id.empty()) parent.push_back(std::move(token));\n\n"
+                "    else if (token.type == Token::TokenType::NEST) {\n"
+                "        std::vector<Token>& tokenChildren = std::get<std::vector<Token>>(token.content);\n\n"
+                "        parent.insert(parent.end(), std::make_move_iterator(tokenChildren.begin()), std::make_move_iterator(tokenChildren.end()));\n"
+                "    }\n}\n\n";
+
+            if (this->usesCodePointRanges) preamble +=
+                "static inline bool inGeneratedCodePointRanges(const char32_t ranges[][2], const int count, const char32_t codePoint)\n{\n"
+                "    int low = 0;\n"
+                "    int high = count;\n\n"
+                "    while (low < high) {\n"
+                "        int middle = (low + high) / 2;\n\n"
+                "        if (ranges[middle][1] < codePoint) low = middle + 1;\n\n"
+                "        else high = middle;\n"
+                "    }\n\n"
+                "    return low < count && ranges[low][0] <= codePoint;\n}\n\n";
+
+            if (this->usesSkipper) preamble +=
+                "typedef ParserCombinatorResult (*GeneratedRule)(const std::string& str, const int start);\n\n"
+                "static thread_local GeneratedRule generatedTrivia = nullptr;\n\n"
+                "static inline int skipGeneratedTrivia(const std::string& str, const int start)\n{\n"
+                "    GeneratedRule trivia = generatedTrivia;\n\n"
+                "    if (trivia == nullptr) return 0;\n\n"
+                "    generatedTrivia = nullptr;\n\n"
+                "    ParserCombinatorResult result = trivia(str, start);\n\n"
+                "    generatedTrivia = trivia;\n\n"
+                "    return std::holds_alternative<Token>(result) ? std::get<Token>(result).width : 0;\n}\n\n";
+
+            return preamble + this->declarations.str() + this->definitions.str() + entryPoints.str();
+        };
+};
+
+std::string generateParser(const std::string functionName, const ParserCombinator parserCombinator)
+{
+    return generateParsers({ { functionName, parserCombinator } });
+};
+
+std::string generateParsers(const std::vector<std::pair<std::string, ParserCombinator>> namedParserCombinators)
+{
+    return ParserGenerator().generate(namedParserCombinators);
+};
@@ -0,0 +1,17 @@
+#ifndef GENERATOR_HPP
+#define GENERATOR_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "parser.hpp"
+
+// emits a C++ source file with one specialized recursive descent function per grammar node
+// opaque predicates are tabulated over all 256 chars, and code point predicates over all code points, so they must be pure,
+// opaque combinators cannot be generated
+
+std::string generateParser(const std::string functionName, const ParserCombinator parserCombinator);
+std::string generateParsers(const std::vector<std::pair<std::string, ParserCombinator>> namedParserCombinators);
+
+#endif
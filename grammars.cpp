@@ -0,0 +1,220 @@
+#include <cctype>
+
+#include "grammars.hpp"
+
+// the builders run once behind a function local static, so grammars shared by parseBatch or parseParallel threads are never rebuilt under them
+
+ParserCombinator buildSimpleLanguageGrammar()
+{
+    Predicate isAlphabetical = [] (const char& c) {
+        return std::isalpha(c);
+    };
+
+    Predicate isNumeric = [] (const char& c) {
+        return std::isdigit(c);
+    };
+
+    ParserCombinator whitespace = satisfy(anyOf({ is(' '), is('\t') })).repeatedly();
+
+    ParserCombinator variable = sequence("VARIABLE", {
+        satisfy("CHAR", anyOf({ isAlphabetical, is('_') })),
+        satisfy("CHAR", anyOf({ isAlphabetical, isNumeric, is('_') })).repeatedly()
+    }).named("variable");
+
+    ParserCombinator number = sequence("NUMBER", {
+        repetition("INT", satisfy("CHAR", isNumeric), 1),
+        optional("DEC", satisfy("CHAR", isNumeric).repeatedly(1).precededBy(satisfy(is('.'))))
+    }).named("number");
+
+    // proxies hold a pointer to the recursive rule, so it has to outlive this call
+    static ParserCombinator expression;
+
+    ParserCombinator group = sequence("GROUP", {
+        satisfy(is('(')),
+        optional(proxyParserCombinator(&expression)),
+        satisfy(is(')'))
+    }).named("group");
+
+    ParserCombinator expressionTerm = sequence("EXPRESSION_TERM", {
+        repetition("PREFIX_OPERATORS", satisfy("CHAR", anyOf({ is('+'), is('-') }))),
+        choice({
+            variable,
+            number,
+            group
+        })
+    }).named("expression term");
+
+    ParserCombinator binaryOperator = satisfy("BINARY_OPERATOR", anyOf({ is('+'), is('-'), is('*'), is('/') })).named("binary operator");
+
+    expression = expressionTerm.surroundedBy(whitespace).repeatedlyWithDelimeter(binaryOperator).named("expression");
+
+    ParserCombinator evaluateBlock = string("eval ").named("\"eval \"").followedBy("EVALUATE", expression);
+
+    ParserCombinator assignmentBlock = sequence("ASSIGNMENT", {
+        string("let ").named("\"let \""),
+        variable.surroundedBy(whitespace),
+        satisfy(is('=')).named("="),
+        expression
+    });
+
+    ParserCombinator ending = satisfy(anyOf({ is(';'), is('\n') })).named("ending");
+
+    // with recovery a broken block is skipped up to the next ending
+
+    ParserCombinator blocks = strictlySequence("BLOCKS", {
+        recoverable("INVALID_BLOCK", choice({
+            whitespace,
+            evaluateBlock,
+            assignmentBlock
+        }).surroundedBy(whitespace), ending).repeatedlyWithDelimeter(ending),
+        ending.optionally()
+    }).named("blocks");
+
+    return blocks;
+};
+
+ParserCombinator simpleLanguageGrammar()
+{
+    static const ParserCombinator grammar = buildSimpleLanguageGrammar();
+
+    return grammar;
+};
+
+// the element rule and the pieces a StreamParser needs to step into an element
+
+struct XmlElementGrammars
+{
+    ParserCombinator openingTag;
+    ParserCombinator child;
+    ParserCombinator closingTag;
+    ParserCombinator nestingTag;
+};
+
+XmlElementGrammars buildXmlElementGrammars()
+{
+    Predicate isAlphabetical = [] (const char& c) {
+        return std::isalpha(c);
+    };
+
+    Predicate isNumeric = [] (const char& c) {
+        return std::isdigit(c);
+    };
+
+    ParserCombinator whitespace = satisfy(anyOf({ is(' '), is('\t') })).repeatedly();
+
+    ParserCombinator tagName = sequence("TAG_NAME", {
+        satisfy("CHAR", isAlphabetical),
+        repetition(satisfy("CHAR", anyOf({ isAlphabetical, isNumeric })))
+    }).named("tag name");
+
+    ParserCombinator tagAttributes = repetition("ATTRIBUTES", sequence({
+        whitespace,
+        sequence("KEY", {
+            satisfy("CHAR", isAlphabetical),
+            repetition(satisfy("CHAR", anyOf({ isAlphabetical, isNumeric })))
+        }).named("key"),
+        whitespace,
+        satisfy(is('=')).named("\"=\""),
+        whitespace,
+        satisfy(is('\"')).named("\""),
+        repetition("VALUE", satisfy("CHAR", negate(is('\"')))).named("value"),
+        satisfy(is('\"')).named("\""),
+    }).named("attribute"));
+
+    ParserCombinator tagContent = sequence({
+        whitespace,
+        tagName,
+        tagAttributes,
+        whitespace
+    }).named("tag content");
+
+    ParserCombinator openingTag = sequence("OPENING_TAG", {
+        whitespace,
+        satisfy(is('<')).named("<"),
+        tagContent,
+        satisfy(is('>')).named(">")
+    }).named("opening tag");
+
+    ParserCombinator closingTag = sequence("CLOSING_TAG", {
+        whitespace,
+        string("</").named("</"),
+        whitespace,
+        tagName,
+        whitespace,
+        satisfy(is('>')).named(">")
+    }).named("closing tag");
+
+    ParserCombinator selfClosingTag = sequence("SELF_CLOSING_TAG", {
+        whitespace,
+        satisfy(is('<')).named("<"),
+        whitespace,
+        tagContent,
+        whitespace,
+        string("/>").named("/>")
+    }).named("self closing tag");
+
+    // proxies hold a pointer to the recursive rule, so it has to outlive this call
+    static ParserCombinator nestingTag;
+
+    ParserCombinator child = choice({
+        repetition("TEXT", satisfy("CHAR", negate(anyOf({ is('<'), is('>') }))), 1).named("text"),
+        selfClosingTag,
+        proxyParserCombinator(&nestingTag)
+    });
+
+    nestingTag = sequence("NESTING_TAG", {
+        openingTag,
+        repetition("CHILDREN", child),
+        closingTag
+    }).named("nesting tag");
+
+    return { openingTag, child, closingTag, nestingTag };
+};
+
+const XmlElementGrammars& xmlElementGrammars()
+{
+    static const XmlElementGrammars grammars = buildXmlElementGrammars();
+
+    return grammars;
+};
+
+// xmlGrammar is built from this same rule, which parseParallel relies on to find its subtrees
+
+ParserCombinator xmlElementGrammar()
+{
+    return xmlElementGrammars().nestingTag;
+};
+
+ParserCombinator xmlOpeningTagGrammar()
+{
+    return xmlElementGrammars().openingTag;
+};
+
+ParserCombinator xmlChildGrammar()
+{
+    return xmlElementGrammars().child;
+};
+
+ParserCombinator xmlClosingTagGrammar()
+{
+    return xmlElementGrammars().closingTag;
+};
+
+ParserCombinator buildXmlGrammar()
+{
+    ParserCombinator nestingTag = xmlElementGrammar();
+
+    ParserCombinator document = strictlyRepetition(choice({
+        nestingTag,
+        satisfy(anyOf({ is(' '), is('\t'), is('\n') }))
+    }));
+
+    return document;
+};
+
+ParserCombinator xmlGrammar()
+{
+    static const ParserCombinator grammar = buildXmlGrammar();
+
+    return grammar;
+};
@@ -0,0 +1,24 @@
+#ifndef GRAMMARS_HPP
+#define GRAMMARS_HPP
+
+#include "parser.hpp"
+
+ParserCombinator simpleLanguageGrammar();
+ParserCombinator xmlGrammar();
+
+// the recursive element rule of xmlGrammar, for starting it at offsets found by indexStructure
+
+ParserCombinator xmlElementGrammar();
+
+// what an element is made of, for a StreamParser that hands out the children of a root element as they arrive
+
+ParserCombinator xmlOpeningTagGrammar();
+ParserCombinator xmlChildGrammar();
+ParserCombinator xmlClosingTagGrammar();
+
+// emitted into generated_parsers.cpp by the generate target
+
+ParserCombinatorResult parseSimpleLanguageGenerated(const std::string& str);
+ParserCombinatorResult parseXmlGenerated(const std::string& str);
+
+#endif
@@ -0,0 +1,165 @@
+#include <stdexcept>
+
+#include "lexer.hpp"
+
+int LexedInput::byteOffset(const int lexemeIndex) const
+{
+    if (lexemeIndex < (int) this->starts.size()) return this->starts[lexemeIndex];
+
+    if (this->starts.empty()) return this->source.size();
+
+    return this->starts.back() + this->widths.back();
+};
+
+void Lexer::addRule(const std::string kindName, const std::string pattern)
+{
+    // kind codes start at 1 so the terminator read past the last lexeme never matches a kind
+
+    if (this->kindNames.size() == 255) throw std::length_error("a lexer supports at most 255 rules");
+
+    this->kindNames.push_back(kindName);
+    this->patterns.push_back(pattern);
+    this->skipped.push_back(false);
+
+    this->built = false;
+};
+
+void Lexer::addSkippedRule(const std::string pattern)
+{
+    this->addRule("", pattern);
+
+    this->skipped.back() = true;
+};
+
+char Lexer::kindCode(const std::string kindName) const
+{
+    for (int rule = 0;rule<(int)this->kindNames.size();rule++) {
+        if (!this->skipped[rule] && this->kindNames[rule] == kindName) return (char) (rule + 1);
+    }
+
+    throw std::invalid_argument("no lexer rule for kind \"" + kindName + "\"");
+};
+
+void Lexer::build()
+{
+    this->dfa = DFA::compile(this->patterns);
+
+    this->built = true;
+};
+
+LexerResult Lexer::tokenize(const std::string& str) const
+{
+    if (!this->built) throw std::logic_error("a lexer has to be built before it tokenizes");
+
+    LexedInput lexedInput;
+
+    lexedInput.source = str;
+
+    int scanStart = 0;
+
+    while (scanStart != (int) str.size()) {
+        int rule = -1;
+
+        int width = this->dfa.match(str, scanStart, rule);
+
+        if (width <= 0) return ParserFailure(scanStart, "lexeme");
+
+        if (!this->skipped[rule]) {
+            lexedInput.kinds += (char) (rule + 1);
+            lexedInput.starts.push_back(scanStart);
+            lexedInput.widths.push_back(width);
+        }
+
+        scanStart += width;
+    }
+
+    return lexedInput;
+};
+
+ParserCombinator Lexer::kind(const std::string kindName) const
+{
+    return this->kind("", kindName);
+};
+
+ParserCombinator Lexer::kind(const std::string tokenId, const std::string kindName) const
+{
+    return satisfy(tokenId, is(this->kindCode(kindName)));
+};
+
+ParserCombinator Lexer::anyKindOf(const std::vector<std::string> kindNames) const
+{
+    return this->anyKindOf("", kindNames);
+};
+
+ParserCombinator Lexer::anyKindOf(const std::string tokenId, const std::vector<std::string> kindNames) const
+{
+    std::vector<Predicate> predicates;
+
+    for (const std::string& kindName : kindNames) predicates.push_back(is(this->kindCode(kindName)));
+
+    return satisfy(tokenId, anyOf(predicates));
+};
+
+ParserCombinator Lexer::kinds(const std::vector<std::string> kindNames) const
+{
+    return this->kinds("", kindNames);
+};
+
+ParserCombinator Lexer::kinds(const std::string tokenId, const std::vector<std::string> kindNames) const
+{
+    std::string kindCodes;
+
+    for (const std::string& kindName : kindNames) kindCodes += this->kindCode(kindName);
+
+    return string(tokenId, kindCodes);
+};
+
+ParserCombinatorResultType getResultType(const LexerResult& result)
+{
+    return result.index() == 0 ? ParserCombinatorResultType::TOKEN : ParserCombinatorResultType::PARSER_FAILURE;
+};
+
+const LexedInput& getLexedInputFromResult(const LexerResult& result)
+{
+    return std::get<LexedInput>(result);
+};
+
+LexedInput getLexedInputFromResult(LexerResult&& result)
+{
+    return std::get<LexedInput>(std::move(result));
+};
+
+const ParserFailure& getParserFailureFromResult(const LexerResult& result)
+{
+    return std::get<ParserFailure>(result);
+};
+
+void mapTokenToSource(Token& token, const LexedInput& lexedInput)
+{
+    int byteStart = lexedInput.byteOffset(token.start);
+    int byteEnd = token.width == 0 ? byteStart : lexedInput.byteOffset(token.start + token.width - 1) + lexedInput.widths[token.start + token.width - 1];
+
+    token.start = byteStart;
+    token.width = byteEnd - byteStart;
+
+    if (token.type == Token::TokenType::STRING_LITERAL) token.content = std::string(lexedInput.source.substr(byteStart, byteEnd - byteStart));
+
+    else for (Token& child : std::get<std::vector<Token>>(token.content)) mapTokenToSource(child, lexedInput);
+};
+
+ParserCombinatorResult parse(const LexedInput& lexedInput, const ParserCombinator parserCombinator)
+{
+    ParserCombinatorResult result = parse(lexedInput.kinds, parserCombinator);
+
+    if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+        ParserFailure& parserFailure = std::get<ParserFailure>(result);
+
+        parserFailure.start = lexedInput.byteOffset(parserFailure.start);
+
+        return result;
+    }
+
+    mapTokenToSource(std::get<Token>(result), lexedInput);
+
+    return result;
+};
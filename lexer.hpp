@@ -0,0 +1,74 @@
+#ifndef LEXER_HPP
+#define LEXER_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <variant>
+
+#include "parser.hpp"
+#include "dfa.hpp"
+
+// lexemes are stored as one kind byte each, so the usual combinators run over the kind string and backtrack per lexeme
+
+class LexedInput
+{
+    public:
+        // the tokenized string, which has to outlive every parse of its lexemes
+
+        std::string_view source;
+
+        std::string kinds;
+        std::vector<int> starts;
+        std::vector<int> widths;
+
+        int byteOffset(const int lexemeIndex) const;
+};
+
+typedef std::variant<LexedInput, ParserFailure> LexerResult;
+
+class Lexer
+{
+    private:
+        std::vector<std::string> kindNames;
+        std::vector<std::string> patterns;
+        std::vector<bool> skipped;
+
+        DFA dfa;
+        bool built = false;
+
+        char kindCode(const std::string kindName) const;
+
+    public:
+        // earlier rules win ties between equally long matches, list keywords before identifiers
+
+        void addRule(const std::string kindName, const std::string pattern);
+        void addSkippedRule(const std::string pattern);
+
+        // compiles the rules into one DFA, after that tokenize only reads the lexer and threads can share it
+
+        void build();
+
+        LexerResult tokenize(const std::string& str) const;
+        LexerResult tokenize(std::string&& str) const = delete;
+
+        ParserCombinator kind(const std::string kindName) const;
+        ParserCombinator kind(const std::string tokenId, const std::string kindName) const;
+
+        ParserCombinator anyKindOf(const std::vector<std::string> kindNames) const;
+        ParserCombinator anyKindOf(const std::string tokenId, const std::vector<std::string> kindNames) const;
+
+        ParserCombinator kinds(const std::vector<std::string> kindNames) const;
+        ParserCombinator kinds(const std::string tokenId, const std::vector<std::string> kindNames) const;
+};
+
+ParserCombinatorResultType getResultType(const LexerResult& result);
+const LexedInput& getLexedInputFromResult(const LexerResult& result);
+LexedInput getLexedInputFromResult(LexerResult&& result);
+const ParserFailure& getParserFailureFromResult(const LexerResult& result);
+
+// positions in the result are mapped back to bytes of the source, literals hold the source text they cover
+
+ParserCombinatorResult parse(const LexedInput& lexedInput, const ParserCombinator parserCombinator);
+
+#endif
@@ -1,23 +1,71 @@
 #include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <map>
+#include <set>
+#include <deque>
+#include <limits>
+#include <algorithm>
+#include <exception>
 
 #include "parser.hpp"
+#include "dfa.hpp"
+#include "unicode.hpp"
+
+CharacterClass::CharacterClass(std::bitset<256> members)
+{
+    this->members = members;
+};
+
+bool CharacterClass::operator()(const char& c) const
+{
+    return this->members[(unsigned char) c];
+};
+
+inline const CharacterClass* getCharacterClass(const Predicate& predicate)
+{
+    return predicate.target<CharacterClass>();
+};
+
+inline bool allCharacterClasses(const std::vector<Predicate>& predicates)
+{
+    for (const Predicate& predicate : predicates) if (getCharacterClass(predicate) == nullptr) return false;
+
+    return true;
+};
 
 Predicate is(const char& c)
 {
-    return [c] (const char& testC) {
-        return c == testC;
-    };
+    std::bitset<256> members;
+
+    members.set((unsigned char) c);
+
+    return CharacterClass(members);
 };
 
 Predicate negate(const Predicate predicate) {
+    const CharacterClass* characterClass = getCharacterClass(predicate);
+
+    if (characterClass != nullptr) return CharacterClass(~characterClass->members);
+
     return [predicate] (const char& c) {
         return !predicate(c);
     };
 };
 
 Predicate anyOf(const std::vector<Predicate> predicates) {
+    if (allCharacterClasses(predicates)) {
+        std::bitset<256> members;
+
+        for (const Predicate& predicate : predicates) members |= getCharacterClass(predicate)->members;
+
+        return CharacterClass(members);
+    }
+
     return [predicates] (const char& c) {
-        for (Predicate predicate : predicates) {
+        for (const Predicate& predicate : predicates) {
             if (predicate(c)) return true;
         }
 
@@ -26,8 +74,10 @@ Predicate anyOf(const std::vector<Predicate> predicates) {
 };
 
 Predicate noneOf(const std::vector<Predicate> predicates) {
+    if (allCharacterClasses(predicates)) return negate(anyOf(predicates));
+
     return [predicates] (const char& c) {
-        for (Predicate predicate : predicates) {
+        for (const Predicate& predicate : predicates) {
             if (predicate(c)) return false;
         }
 
@@ -35,20 +85,20 @@ Predicate noneOf(const std::vector<Predicate> predicates) {
     };
 }
 
-Token::Token(std::string id, std::string stringLiteral, const int start, int width)
+Token::Token(std::string id, std::string stringLiteral, const int64_t start, int64_t width)
 {
-    this->id = id;
+    this->id = std::move(id);
     this->type = Token::TokenType::STRING_LITERAL;
-    this->content = stringLiteral;
+    this->content = std::move(stringLiteral);
     this->start = start;
     this->width = width;
 };
 
-Token::Token(std::string id, std::vector<Token> NEST, const int start, int width)
+Token::Token(std::string id, std::vector<Token> NEST, const int64_t start, int64_t width)
 {
-    this->id = id;
+    this->id = std::move(id);
     this->type = Token::TokenType::NEST;
-    this->content = NEST;
+    this->content = std::move(NEST);
     this->start = start;
     this->width = width;
 };
@@ -104,572 +154,3144 @@ std::string Token::contentString() const
     return childrenString;
 };
 
-inline void addChildToken(std::vector<Token>& parent, const Token& token)
+inline void discardUnwrappedToken(const Token& token);
+
+inline void addChildToken(std::vector<Token>& parent, Token&& token)
 {
-    if (!token.id.empty()) parent.push_back(token);
+    if (!token.id.empty()) {
+        parent.push_back(std::move(token));
 
-    else if(token.type == Token::TokenType::NEST) {
-        const std::vector<Token>& tokenChildren = token.getNestingContent();
+        return;
+    }
+
+    if (token.type == Token::TokenType::NEST) {
+        std::vector<Token>& tokenChildren = std::get<std::vector<Token>>(token.content);
 
-        parent.insert(parent.end(), tokenChildren.begin(), tokenChildren.end());
+        parent.insert(parent.end(), std::make_move_iterator(tokenChildren.begin()), std::make_move_iterator(tokenChildren.end()));
     }
+
+    discardUnwrappedToken(token);
 };
 
-ParserFailure::ParserFailure(int start)
+// children leave a scratch vector in an exactly sized vector of their own, the scratch buffer stays with the pool
+
+inline std::vector<Token> takeTokens(std::vector<Token>& tokens)
 {
-    this->start = start;
-    this->name = "";
+    return std::vector<Token>(std::make_move_iterator(tokens.begin()), std::make_move_iterator(tokens.end()));
 };
 
-ParserFailure::ParserFailure(int start, std::string name)
+// per thread buffers reused across combinator calls and documents, so steady state parsing does not regrow vectors
+
+struct ParserScratch
 {
-    this->start = start;
-    this->name = "\033[34m" + name + "\033[0m";
+    std::vector<std::vector<Token>> tokenVectors;
+    std::vector<std::vector<ParserFailure>> parserFailureVectors;
 };
 
-ParserFailure ParserFailure::composeFrom(std::vector<ParserFailure> parserFailures)
+thread_local ParserScratch parserScratch;
+
+template <typename T>
+class ScratchVector
 {
-    std::vector<std::string> parserFailureNames;
+    private:
+        std::vector<std::vector<T>>& pool;
 
-    for (const ParserFailure& parserFailure : parserFailures) if (parserFailure.name.size() != 0) parserFailureNames.push_back(parserFailure.name);
+    public:
+        std::vector<T> items;
 
-    std::string names;
+        ScratchVector(std::vector<std::vector<T>>& pool) : pool(pool)
+        {
+            if (pool.empty()) return;
 
-    for (int i = 0;i<(int)parserFailureNames.size();i++) {
-        if (i == 0) names += parserFailureNames[0];
+            this->items = std::move(pool.back());
 
-        else names += " | " + parserFailureNames[i];
-    }
+            pool.pop_back();
+        };
 
-    return ParserFailure(parserFailures[0].start, names);
-};
+        ~ScratchVector()
+        {
+            this->items.clear();
 
-std::string ParserFailure::toString() const
-{
-    std::string locationString = "Error at char " + std::to_string(this->start + 1) + ". ";
+            this->pool.push_back(std::move(this->items));
+        };
 
-    std::string expectedString = this->name.empty() ? "" : "Expected " + this->name;
-    
-    return locationString + expectedString;
+        ScratchVector(const ScratchVector&) = delete;
+        ScratchVector& operator=(const ScratchVector&) = delete;
 };
 
-ParserCombinatorResultType getResultType(ParserCombinatorResult result)
-{
-    return result.index() == 0 ? ParserCombinatorResultType::TOKEN : ParserCombinatorResultType::PARSER_FAILURE;
-};
+// dynamically scoped settings of the running parse, copied into any thread a parse fans out to
 
-Token getTokenFromResult(ParserCombinatorResult result)
+class Skipper
 {
-    return std::get<Token>(result);
-};
+    public:
+        ParserCombinator trivia;
 
-ParserFailure getParserFailureFromResult(ParserCombinatorResult result)
-{
-    return std::get<ParserFailure>(result);
-};
+        bool isCharacterRun = false;
+        std::bitset<256> characters;
+        int minCount = 0;
+        int maxCount = 0;
 
-ParserCombinator::ParserCombinator(std::function<ParserCombinatorResult(const std::string&, const int)> implementation)
-{
-    this->implementation = implementation;
+        Skipper(const ParserCombinator trivia);
 };
 
-ParserCombinatorResult ParserCombinator::operator()(const std::string& str, const int start) const
-{
-    return this->implementation(str, start);
-};
+// shared by every thread of one parse, each thread spends steps from a local allowance and settles up here between allowances
 
-ParserCombinator ParserCombinator::repeatedly() const
+struct ParseBudget
 {
-    return repetition(*this);
-};
+    long long maxSteps;
+    std::chrono::steady_clock::time_point deadline;
+    const std::atomic<bool>* cancellation;
 
-ParserCombinator ParserCombinator::repeatedly(const int minCount) const
-{
-    return repetition(*this, minCount);
-};
+    std::atomic<long long> steps { 0 };
+    std::atomic<int> farthestPosition { 0 };
+    std::atomic<int> exhaustion { ParserFailure::ParserFailureType::MISMATCH };
 
-ParserCombinator ParserCombinator::repeatedly(const int minCount, const int maxCount) const
-{
-    return repetition(*this, minCount, maxCount);
+    ParseBudget(const ParseOptions& options) : maxSteps(options.maxSteps), deadline(options.deadline), cancellation(options.cancellation) {};
 };
 
-ParserCombinator ParserCombinator::strictlyRepeatedly() const
-{
-    return strictlyRepetition(*this);
-};
+// shared by every thread of one parse like the budget, it only counts while a parse asked for telemetry
 
-ParserCombinator ParserCombinator::strictlyRepeatedly(const int minCount) const
+struct TelemetryCounters
 {
-    return strictlyRepetition(*this, minCount);
+    std::atomic<long long> nodesCreated { 0 };
+    std::atomic<long long> nodesDiscarded { 0 };
+    std::atomic<long long> bytesAllocated { 0 };
+    std::atomic<long long> liveBytes { 0 };
+    std::atomic<long long> peakLiveBytes { 0 };
+    std::atomic<int> maxDepth { 0 };
 };
 
-ParserCombinator ParserCombinator::strictlyRepeatedly(const int minCount, const int maxCount) const
+struct ParseState
 {
-    return strictlyRepetition(*this, minCount, maxCount);
-};
+    const Skipper* skipper = nullptr;
 
-ParserCombinator ParserCombinator::repeatedlyWithDelimeter(const ParserCombinator delimiter) const
-{
-    return sequence({
-        *this,
-        sequence({
-            delimiter,
-            *this
-        }).repeatedly()
-    });
-};
+    bool splicing = true;
 
-ParserCombinator ParserCombinator::repeatedlyWithDelimeter(const std::string wrapperTokenId, const ParserCombinator delimiter) const
-{
-    return sequence(wrapperTokenId, {
-        *this,
-        sequence({
-            delimiter,
-            *this
-        }).repeatedly()
-    });
-};
+    std::vector<ParserFailure>* recoveredFailures = nullptr;
 
-ParserCombinator ParserCombinator::strictlyRepeatedlyWithDelimeter(const ParserCombinator delimiter) const
-{
-    return sequence({
-        *this,
-        sequence({
-            delimiter,
-            *this
-        }).strictlyRepeatedly()
-    });
-};
+    // inside the item of a recoverable, the failure that got farthest
+    ParserFailure* farthestFailure = nullptr;
 
-ParserCombinator ParserCombinator::strictlyRepeatedlyWithDelimeter(const std::string wrapperTokenId, const ParserCombinator delimiter) const
-{
-    return sequence(wrapperTokenId, {
-        *this,
-        sequence({
-            delimiter,
-            *this
-        }).strictlyRepeatedly()
-    });
-};
+    bool inputEndReached = false;
 
-ParserCombinator ParserCombinator::optionally() const
-{
-    return optional(*this);
-};
+    PrecomputedResults* precomputedResults = nullptr;
 
-ParserCombinator ParserCombinator::optionally(const std::string wrapperTokenId) const
-{
-    return optional(wrapperTokenId, *this);
-};
+    TelemetryCounters* telemetry = nullptr;
+    int depth = 0;
 
-ParserCombinator ParserCombinator::precededBy(const ParserCombinator predecessor) const
-{
-    return precededBy("", predecessor);
+    ParseBudget* budget = nullptr;
+    int allowance = 0;
+    int stepsUntilCheck = 0;
+    int farthestPosition = 0;
 };
 
-ParserCombinator ParserCombinator::precededBy(const std::string wrapperTokenId, const ParserCombinator predecessor) const
-{
-    return sequence(wrapperTokenId, {
-        predecessor,
-        *this
-    });
-};
+thread_local ParseState parseState;
 
-ParserCombinator ParserCombinator::followedBy(const ParserCombinator predecessor) const
-{
-    return followedBy("", predecessor);
-};
+// a thread joining a running parse starts with no allowance and settles what it spent before it leaves
 
-ParserCombinator ParserCombinator::followedBy(const std::string wrapperTokenId, const ParserCombinator predecessor) const
+ParseState forkParseState()
 {
-    return sequence(wrapperTokenId, {
-        *this,
-        predecessor
-    });
-};
+    ParseState forkedParseState = parseState;
 
-ParserCombinator ParserCombinator::surroundedBy(const ParserCombinator neighbor) const
-{
-    return surroundedBy("", neighbor);
-};
+    forkedParseState.allowance = 0;
+    forkedParseState.stepsUntilCheck = 0;
 
-ParserCombinator ParserCombinator::surroundedBy(const std::string wrapperTokenId, const ParserCombinator neighbor) const
-{
-    return sequence(wrapperTokenId, {
-        neighbor,
-        *this,
-        neighbor
-    });
+    return forkedParseState;
 };
 
-ParserCombinator ParserCombinator::named(const std::string name) const
+const int parseBudgetCheckInterval = 1024;
+
+void settleParseBudget()
 {
-    return ParserCombinator([*this, name] (const std::string& str, const int start) -> ParserCombinatorResult {
-        ParserCombinatorResult result = (*this)(str, start);
-        
-        if (getResultType(result) == ParserCombinatorResultType::TOKEN) return result;
+    ParseBudget* budget = parseState.budget;
 
-        ParserFailure defaultParserFailure = getParserFailureFromResult(result);
+    budget->steps += parseState.allowance - parseState.stepsUntilCheck;
 
-        std::string bestName = defaultParserFailure.name.empty() ? name : defaultParserFailure.name;
+    parseState.allowance = 0;
+    parseState.stepsUntilCheck = 0;
 
-        return ParserFailure(defaultParserFailure.start, bestName);
-    });
-};
+    int farthestPosition = budget->farthestPosition;
 
-ParserCombinator satisfy(const Predicate predicate)
-{
-    return satisfy("", predicate);
+    while (parseState.farthestPosition > farthestPosition && !budget->farthestPosition.compare_exchange_weak(farthestPosition, parseState.farthestPosition));
 };
 
-ParserCombinator satisfy(const std::string tokenId, const Predicate predicate)
+bool checkParseBudget()
 {
-    return ParserCombinator([tokenId, predicate] (const std::string& str, const int start) -> ParserCombinatorResult {
-        const char& c = str[start];
+    settleParseBudget();
 
-        if (predicate(c)) return Token(tokenId, std::string(1, c), start, 1);
+    ParseBudget* budget = parseState.budget;
 
-        else return ParserFailure(start);
-    });
-};
+    int exhaustion = ParserFailure::ParserFailureType::MISMATCH;
 
-ParserCombinator repetition(const ParserCombinator nestedTokenGenerator)
-{
-    return repetition("", nestedTokenGenerator);
-};
+    long long steps = budget->steps;
 
-ParserCombinator repetition(const ParserCombinator nestedTokenGenerator, const int minCount)
-{
-    return repetition("", nestedTokenGenerator, minCount);
+    if (budget->maxSteps > 0 && steps > budget->maxSteps) exhaustion = ParserFailure::ParserFailureType::STEP_LIMIT;
+
+    else if (budget->cancellation != nullptr && budget->cancellation->load(std::memory_order_relaxed)) exhaustion = ParserFailure::ParserFailureType::CANCELLED;
+
+    else if (budget->deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= budget->deadline) exhaustion = ParserFailure::ParserFailureType::DEADLINE;
+
+    if (exhaustion != ParserFailure::ParserFailureType::MISMATCH) {
+        int expected = ParserFailure::ParserFailureType::MISMATCH;
+
+        budget->exhaustion.compare_exchange_strong(expected, exhaustion);
+    }
+
+    if (budget->exhaustion != ParserFailure::ParserFailureType::MISMATCH) return true;
+
+    long long allowance = parseBudgetCheckInterval;
+
+    if (budget->maxSteps > 0 && budget->maxSteps - steps < allowance) allowance = budget->maxSteps - steps;
+
+    parseState.allowance = allowance;
+    parseState.stepsUntilCheck = allowance;
+
+    return false;
 };
 
-ParserCombinator repetition(const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+// charged once per combinator call, without a budget this is a single branch
+
+inline bool outOfParseBudget(const int start)
 {
-    return repetition("", nestedTokenGenerator, minCount, maxCount);
+    if (parseState.budget == nullptr) return false;
+
+    if (start > parseState.farthestPosition) parseState.farthestPosition = start;
+
+    if (--parseState.stepsUntilCheck >= 0) return false;
+
+    return checkParseBudget();
 };
 
-ParserCombinator repetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator)
+class ParseBudgetScope
 {
-    return repetition(tokenId, nestedTokenGenerator, 0, std::numeric_limits<int>::max());
+    private:
+        ParseState previousParseState;
+
+    public:
+        ParseBudgetScope(ParseBudget* budget)
+        {
+            this->previousParseState = parseState;
+
+            parseState.budget = budget;
+            parseState.allowance = 0;
+            parseState.stepsUntilCheck = 0;
+            parseState.farthestPosition = 0;
+        };
+
+        ~ParseBudgetScope()
+        {
+            settleParseBudget();
+
+            parseState.budget = this->previousParseState.budget;
+            parseState.allowance = this->previousParseState.allowance;
+            parseState.stepsUntilCheck = this->previousParseState.stepsUntilCheck;
+            parseState.farthestPosition = this->previousParseState.farthestPosition;
+        };
+
+        ParseBudgetScope(const ParseBudgetScope&) = delete;
+        ParseBudgetScope& operator=(const ParseBudgetScope&) = delete;
 };
 
-ParserCombinator repetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount)
+// strings up to this long are stored inside the string object and allocate nothing
+const size_t inlineStringCapacity = std::string().capacity();
+
+inline long long stringBytes(const std::string& str)
 {
-    return repetition(tokenId, nestedTokenGenerator, minCount, std::numeric_limits<int>::max());
+    return str.capacity() > inlineStringCapacity ? str.capacity() + 1 : 0;
 };
 
-ParserCombinator repetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+// what a token holds on the heap, its contents are not changed after construction so this is also what dropping it frees
+
+inline long long tokenBytes(const Token& token)
 {
-    return ParserCombinator([tokenId, nestedTokenGenerator, minCount, maxCount] (const std::string& str, const int start) -> ParserCombinatorResult {
-        std::vector<Token> nestedTokens;
+    long long bytes = stringBytes(token.id);
 
-        int tokensFound = 0;
-    
-        int scanStart = start;
+    if (const std::string* stringLiteral = std::get_if<std::string>(&token.content)) bytes += stringBytes(*stringLiteral);
 
-        while (scanStart != (int) str.size()) {
-            if (tokensFound == maxCount) break;
+    else bytes += std::get<std::vector<Token>>(token.content).capacity() * sizeof(Token);
 
-            ParserCombinatorResult result = nestedTokenGenerator(str, scanStart);
+    return bytes;
+};
 
-            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) break;
+// tokens are counted where the combinators build and drop them, next to a read of the parse state they already make,
+// so a parse without telemetry only tests a null pointer there and copies and moves of tokens are never counted
 
-            Token token = getTokenFromResult(result);
+template <typename... TokenArguments>
+inline Token createToken(TokenArguments&&... tokenArguments)
+{
+    Token token(std::forward<TokenArguments>(tokenArguments)...);
 
-            if (token.width == 0) break;
+    TelemetryCounters* telemetry = parseState.telemetry;
 
-            tokensFound++;
+    if (telemetry == nullptr) return token;
 
-            addChildToken(nestedTokens, token);
+    long long bytes = tokenBytes(token);
 
-            scanStart += token.width;
-        }
+    telemetry->nodesCreated++;
+    telemetry->bytesAllocated += bytes;
 
-        if (tokensFound < minCount) return ParserFailure(scanStart);
+    long long liveBytes = telemetry->liveBytes += bytes;
+    long long peakLiveBytes = telemetry->peakLiveBytes;
 
-        else return Token(tokenId, nestedTokens, start, scanStart - start);
-    });
+    while (liveBytes > peakLiveBytes && !telemetry->peakLiveBytes.compare_exchange_weak(peakLiveBytes, liveBytes));
+
+    return token;
 };
 
-ParserCombinator strictlyRepetition(const ParserCombinator nestedTokenGenerator)
+inline void countDiscardedTree(TelemetryCounters* telemetry, const Token& token)
 {
-    return strictlyRepetition("", nestedTokenGenerator);
+    telemetry->nodesDiscarded++;
+    telemetry->liveBytes -= tokenBytes(token);
+
+    if (token.type == Token::TokenType::NEST) for (const Token& child : token.getNestingContent()) countDiscardedTree(telemetry, child);
 };
 
-ParserCombinator strictlyRepetition(const ParserCombinator nestedTokenGenerator, const int minCount)
+// a token dropped with everything under it, a failed alternative or a match thrown away by its parent
+
+inline void discardToken(const Token& token)
 {
-    return strictlyRepetition("", nestedTokenGenerator, minCount);
+    TelemetryCounters* telemetry = parseState.telemetry;
+
+    if (telemetry != nullptr) countDiscardedTree(telemetry, token);
 };
 
-ParserCombinator strictlyRepetition(const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+inline void discardResult(const ParserCombinatorResult& result)
 {
-    return strictlyRepetition("", nestedTokenGenerator, minCount, maxCount);
+    if (getResultType(result) == ParserCombinatorResultType::TOKEN) discardToken(std::get<Token>(result));
 };
 
-ParserCombinator strictlyRepetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator)
+// rolls spliced children back to where a failed branch started
+
+inline void discardTokens(std::vector<Token>& tokens, const int firstToken)
 {
-    return strictlyRepetition(tokenId, nestedTokenGenerator, 0, std::numeric_limits<int>::max());
+    TelemetryCounters* telemetry = parseState.telemetry;
+
+    if (telemetry != nullptr) for (int i = firstToken;i<(int)tokens.size();i++) countDiscardedTree(telemetry, tokens[i]);
+
+    tokens.erase(tokens.begin() + firstToken, tokens.end());
 };
 
-ParserCombinator strictlyRepetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount)
+// an anonymous token whose children moved into its parent, only the token itself is dropped
+
+inline void discardUnwrappedToken(const Token& token)
 {
-    return strictlyRepetition(tokenId, nestedTokenGenerator, minCount, std::numeric_limits<int>::max());
+    TelemetryCounters* telemetry = parseState.telemetry;
+
+    if (telemetry == nullptr) return;
+
+    telemetry->nodesDiscarded++;
+    telemetry->liveBytes -= tokenBytes(token);
 };
 
-ParserCombinator strictlyRepetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+// one level of combinator nesting, only tracked with telemetry
+
+class ParseDepthScope
 {
-    return ParserCombinator([tokenId, nestedTokenGenerator, minCount, maxCount] (const std::string& str, const int start) -> ParserCombinatorResult {
-        std::vector<Token> nestedTokens;
+    private:
+        bool counted;
 
-        int tokensFound = 0;
-    
-        int scanStart = start;
+    public:
+        ParseDepthScope()
+        {
+            TelemetryCounters* telemetry = parseState.telemetry;
 
-        while (scanStart != (int) str.size()) {
-            if (tokensFound == maxCount) break;
+            this->counted = telemetry != nullptr;
 
-            ParserCombinatorResult result = nestedTokenGenerator(str, scanStart);
+            if (!this->counted) return;
 
-            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+            int depth = ++parseState.depth;
+            int maxDepth = telemetry->maxDepth;
 
-            Token token = getTokenFromResult(result);
+            while (depth > maxDepth && !telemetry->maxDepth.compare_exchange_weak(maxDepth, depth));
+        };
 
-            if (token.width == 0) return ParserFailure(scanStart);
+        ~ParseDepthScope()
+        {
+            if (this->counted) parseState.depth--;
+        };
 
-            tokensFound++;
+        ParseDepthScope(const ParseDepthScope&) = delete;
+        ParseDepthScope& operator=(const ParseDepthScope&) = delete;
+};
 
-            addChildToken(nestedTokens, token);
+class ParseTelemetryScope
+{
+    private:
+        TelemetryCounters* previousTelemetry;
+        int previousDepth;
+
+    public:
+        ParseTelemetryScope(TelemetryCounters* telemetry)
+        {
+            this->previousTelemetry = parseState.telemetry;
+            this->previousDepth = parseState.depth;
+
+            parseState.telemetry = telemetry;
+            parseState.depth = 0;
+        };
+
+        ~ParseTelemetryScope()
+        {
+            parseState.telemetry = this->previousTelemetry;
+            parseState.depth = this->previousDepth;
+        };
+
+        ParseTelemetryScope(const ParseTelemetryScope&) = delete;
+        ParseTelemetryScope& operator=(const ParseTelemetryScope&) = delete;
+};
+
+class PrecomputedResultsScope
+{
+    private:
+        PrecomputedResults* previousPrecomputedResults;
+
+    public:
+        PrecomputedResultsScope(PrecomputedResults* precomputedResults)
+        {
+            this->previousPrecomputedResults = parseState.precomputedResults;
+
+            parseState.precomputedResults = precomputedResults;
+        };
+
+        ~PrecomputedResultsScope()
+        {
+            parseState.precomputedResults = this->previousPrecomputedResults;
+        };
+
+        PrecomputedResultsScope(const PrecomputedResultsScope&) = delete;
+        PrecomputedResultsScope& operator=(const PrecomputedResultsScope&) = delete;
+};
+
+class SkipperScope
+{
+    private:
+        const Skipper* previousSkipper;
+
+    public:
+        SkipperScope(const Skipper* skipper)
+        {
+            this->previousSkipper = parseState.skipper;
+
+            parseState.skipper = skipper;
+        };
+
+        ~SkipperScope()
+        {
+            parseState.skipper = this->previousSkipper;
+        };
+
+        SkipperScope(const SkipperScope&) = delete;
+        SkipperScope& operator=(const SkipperScope&) = delete;
+};
+
+class SplicingScope
+{
+    private:
+        bool previousSplicing;
+
+    public:
+        SplicingScope(const bool splicing)
+        {
+            this->previousSplicing = parseState.splicing;
+
+            parseState.splicing = splicing;
+        };
+
+        ~SplicingScope()
+        {
+            parseState.splicing = this->previousSplicing;
+        };
+
+        SplicingScope(const SplicingScope&) = delete;
+        SplicingScope& operator=(const SplicingScope&) = delete;
+};
+
+class RecoveredFailuresScope
+{
+    private:
+        std::vector<ParserFailure>* previousRecoveredFailures;
+
+    public:
+        RecoveredFailuresScope(std::vector<ParserFailure>* recoveredFailures)
+        {
+            this->previousRecoveredFailures = parseState.recoveredFailures;
+
+            parseState.recoveredFailures = recoveredFailures;
+        };
+
+        ~RecoveredFailuresScope()
+        {
+            parseState.recoveredFailures = this->previousRecoveredFailures;
+        };
+
+        RecoveredFailuresScope(const RecoveredFailuresScope&) = delete;
+        RecoveredFailuresScope& operator=(const RecoveredFailuresScope&) = delete;
+};
+
+// only called while recovering, where every combinator call already goes through the slower path
+
+inline void noteFarthestFailure(const ParserFailure& parserFailure)
+{
+    ParserFailure* farthestFailure = parseState.farthestFailure;
+
+    // outer combinators return last, so of the failures at one position the most descriptive one is kept
+
+    if (farthestFailure != nullptr && parserFailure.start >= farthestFailure->start) *farthestFailure = parserFailure;
+};
+
+class FarthestFailureScope
+{
+    private:
+        ParserFailure* previousFarthestFailure;
+
+    public:
+        FarthestFailureScope(ParserFailure* farthestFailure)
+        {
+            this->previousFarthestFailure = parseState.farthestFailure;
+
+            parseState.farthestFailure = farthestFailure;
+        };
+
+        ~FarthestFailureScope()
+        {
+            parseState.farthestFailure = this->previousFarthestFailure;
+        };
+
+        FarthestFailureScope(const FarthestFailureScope&) = delete;
+        FarthestFailureScope& operator=(const FarthestFailureScope&) = delete;
+};
+
+// set whenever a match looks at or past the end of the input, a streamed item is only final if nothing did
+
+inline void reachInputEnd(const std::string& str, const int position)
+{
+    if (position >= (int) str.size()) parseState.inputEndReached = true;
+};
+
+int skipTrivia(const std::string& str, const int start);
+
+ParserFailure::ParserFailure(int64_t start)
+{
+    this->start = start;
+    this->name = "";
+};
+
+ParserFailure::ParserFailure(int64_t start, std::string name)
+{
+    this->start = start;
+    this->name = "\033[34m" + name + "\033[0m";
+};
+
+ParserFailure::ParserFailure(int64_t start, ParserFailureType type)
+{
+    this->start = start;
+    this->name = "";
+    this->type = type;
+};
+
+ParserFailure ParserFailure::composeFrom(std::vector<ParserFailure> parserFailures)
+{
+    std::vector<std::string> parserFailureNames;
+
+    for (const ParserFailure& parserFailure : parserFailures) if (parserFailure.name.size() != 0) parserFailureNames.push_back(parserFailure.name);
+
+    std::string names;
+
+    for (int i = 0;i<(int)parserFailureNames.size();i++) {
+        if (i == 0) names += parserFailureNames[0];
+
+        else names += " | " + parserFailureNames[i];
+    }
+
+    return ParserFailure(parserFailures[0].start, names);
+};
+
+std::string ParserFailure::toString() const
+{
+    if (this->type == ParserFailureType::STEP_LIMIT) return "Step limit reached, got as far as char " + std::to_string(this->start + 1) + ".";
+
+    if (this->type == ParserFailureType::DEADLINE) return "Deadline passed, got as far as char " + std::to_string(this->start + 1) + ".";
+
+    if (this->type == ParserFailureType::CANCELLED) return "Parse cancelled, got as far as char " + std::to_string(this->start + 1) + ".";
+
+    std::string locationString = "Error at char " + std::to_string(this->start + 1) + ". ";
+
+    std::string expectedString = this->name.empty() ? "" : "Expected " + this->name;
+    
+    return locationString + expectedString;
+};
+
+ParserCombinatorResultType getResultType(const ParserCombinatorResult& result)
+{
+    return result.index() == 0 ? ParserCombinatorResultType::TOKEN : ParserCombinatorResultType::PARSER_FAILURE;
+};
+
+const Token& getTokenFromResult(const ParserCombinatorResult& result)
+{
+    return std::get<Token>(result);
+};
+
+Token getTokenFromResult(ParserCombinatorResult&& result)
+{
+    return std::get<Token>(std::move(result));
+};
+
+const ParserFailure& getParserFailureFromResult(const ParserCombinatorResult& result)
+{
+    return std::get<ParserFailure>(result);
+};
+
+ParserFailure getParserFailureFromResult(ParserCombinatorResult&& result)
+{
+    return std::get<ParserFailure>(std::move(result));
+};
+
+ParserCombinatorResultType getResultType(const RecognizerResult& result)
+{
+    return result.index() == 0 ? ParserCombinatorResultType::TOKEN : ParserCombinatorResultType::PARSER_FAILURE;
+};
+
+int getWidthFromResult(const RecognizerResult& result)
+{
+    return std::get<int>(result);
+};
+
+const ParserFailure& getParserFailureFromResult(const RecognizerResult& result)
+{
+    return std::get<ParserFailure>(result);
+};
+
+ParserCombinator::ParserCombinator(std::function<ParserCombinatorResult(const std::string&, const int)> implementation)
+{
+    this->implementation = std::make_shared<const std::function<ParserCombinatorResult(const std::string&, const int)>>(std::move(implementation));
+    this->grammarNode = std::make_shared<const GrammarNode>(GrammarNode::GrammarNodeType::OPAQUE);
+};
+
+ParserCombinator::ParserCombinator(std::function<ParserCombinatorResult(const std::string&, const int)> implementation, GrammarNode grammarNode)
+{
+    this->implementation = std::make_shared<const std::function<ParserCombinatorResult(const std::string&, const int)>>(std::move(implementation));
+    this->grammarNode = std::make_shared<const GrammarNode>(std::move(grammarNode));
+};
+
+ParserCombinator::ParserCombinator(std::function<ParserCombinatorResult(const std::string&, const int)> implementation, TokenSplicer splicer, GrammarNode grammarNode)
+{
+    this->implementation = std::make_shared<const std::function<ParserCombinatorResult(const std::string&, const int)>>(std::move(implementation));
+    this->grammarNode = std::make_shared<const GrammarNode>(std::move(grammarNode));
+
+    if (splicer) this->splicer = std::make_shared<const TokenSplicer>(std::move(splicer));
+};
+
+ParserCombinatorResult ParserCombinator::operator()(const std::string& str, const int start) const
+{
+    if (!this->implementation) throw std::bad_function_call();
+
+    ParseDepthScope parseDepthScope;
+
+    if (outOfParseBudget(start)) return ParserFailure(start);
+
+    // results parsed ahead of time were parsed without trivia, so they only stand in where no skipper is active
+
+    PrecomputedResults* precomputedResults = parseState.precomputedResults;
+
+    if (precomputedResults != nullptr && parseState.skipper == nullptr && this->grammarNode.get() == precomputedResults->parserCombinator.getGrammarNode()) {
+        auto precomputedResult = precomputedResults->results.find(start);
+
+        if (precomputedResult != precomputedResults->results.end()) return precomputedResult->second;
+    }
+
+    std::vector<ParserFailure>* recoveredFailures = parseState.recoveredFailures;
+
+    if (recoveredFailures == nullptr) return (*this->implementation)(str, start);
+
+    // a combinator that fails takes back whatever recovery recorded inside it
+
+    int firstRecoveredFailure = recoveredFailures->size();
+
+    ParserCombinatorResult result = (*this->implementation)(str, start);
+
+    if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+        recoveredFailures->erase(recoveredFailures->begin() + firstRecoveredFailure, recoveredFailures->end());
+
+        noteFarthestFailure(std::get<ParserFailure>(result));
+    }
+
+    return result;
+};
+
+// anonymous combinators splice straight into the caller, everything else builds its token and moves it in
+
+RecognizerResult ParserCombinator::parseInto(const std::string& str, const int start, std::vector<Token>& tokens) const
+{
+    // the combinator with precomputed results goes through operator(), which looks them up
+
+    PrecomputedResults* precomputedResults = parseState.precomputedResults;
+
+    bool precomputed = precomputedResults != nullptr && this->grammarNode.get() == precomputedResults->parserCombinator.getGrammarNode();
+
+    if (this->splicer && parseState.splicing && !precomputed) {
+        ParseDepthScope parseDepthScope;
+
+        if (outOfParseBudget(start)) return ParserFailure(start);
+
+        std::vector<ParserFailure>* recoveredFailures = parseState.recoveredFailures;
+
+        if (recoveredFailures == nullptr) return (*this->splicer)(str, start, tokens);
+
+        int firstRecoveredFailure = recoveredFailures->size();
+
+        RecognizerResult result = (*this->splicer)(str, start, tokens);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+            recoveredFailures->erase(recoveredFailures->begin() + firstRecoveredFailure, recoveredFailures->end());
+
+            noteFarthestFailure(std::get<ParserFailure>(result));
+        }
+
+        return result;
+    }
+
+    ParserCombinatorResult result = (*this)(str, start);
+
+    if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return getParserFailureFromResult(std::move(result));
+
+    Token& token = std::get<Token>(result);
+
+    int width = token.width;
+
+    addChildToken(tokens, std::move(token));
+
+    return width;
+};
+
+Skipper::Skipper(const ParserCombinator trivia)
+{
+    this->trivia = trivia;
+
+    const GrammarNode* grammarNode = trivia.getGrammarNode();
+
+    if (grammarNode == nullptr) return;
+
+    this->minCount = 1;
+    this->maxCount = 1;
+
+    if (grammarNode->type == GrammarNode::GrammarNodeType::REPETITION) {
+        this->minCount = grammarNode->minCount;
+        this->maxCount = grammarNode->maxCount;
+
+        grammarNode = grammarNode->children[0].getGrammarNode();
+    }
+
+    if (grammarNode == nullptr || grammarNode->type != GrammarNode::GrammarNodeType::SATISFY) return;
+
+    const CharacterClass* characterClass = getCharacterClass(grammarNode->predicate);
+
+    if (characterClass == nullptr || characterClass->members[0]) return;
+
+    this->isCharacterRun = true;
+    this->characters = characterClass->members;
+};
+
+// trivia never skips inside itself, a failing trivia just skips nothing
+
+int skipTrivia(const std::string& str, const int start)
+{
+    const Skipper* skipper = parseState.skipper;
+
+    if (skipper == nullptr) return 0;
+
+    if (skipper->isCharacterRun) {
+        int end = start;
+
+        while (end < (int) str.size() && end - start < skipper->maxCount && skipper->characters[(unsigned char) str[end]]) end++;
+
+        if (end - start < skipper->maxCount) reachInputEnd(str, end);
+
+        return end - start < skipper->minCount ? 0 : end - start;
+    }
+
+    SkipperScope skipperScope(nullptr);
+
+    RecognizerResult result = skipper->trivia.recognize(str, start);
+
+    return getResultType(result) == ParserCombinatorResultType::TOKEN ? std::get<int>(result) : 0;
+};
+
+RecognizerResult matchLiteralRun(const std::string& stringLiteral, const std::vector<int>& segmentStarts, const std::string& str, const int start)
+{
+    int scanStart = start;
+
+    for (int segment = 0;segment<(int)segmentStarts.size();segment++) {
+        int segmentEnd = segment + 1 < (int) segmentStarts.size() ? segmentStarts[segment + 1] : stringLiteral.size();
+
+        for (int i = segmentStarts[segment];i<segmentEnd;i++) {
+            int position = scanStart + i - segmentStarts[segment];
+
+            if (position >= (int) str.size() || str[position] != stringLiteral[i]) {
+                reachInputEnd(str, position);
+
+                return ParserFailure(scanStart);
+            }
+        }
+
+        scanStart += segmentEnd - segmentStarts[segment];
+
+        scanStart += skipTrivia(str, scanStart);
+    }
+
+    return scanStart - start;
+};
+
+RecognizerResult matchCodePointRun(const CodePointClass& codePointClass, const int minCount, const int maxCount, const std::string& str, const int start)
+{
+    int count;
+    bool reachedEnd;
+
+    int end = codePointClass.matchRun(str, start, maxCount, count, reachedEnd);
+
+    if (reachedEnd) parseState.inputEndReached = true;
+
+    if (count < minCount) return ParserFailure(end);
+
+    return end - start;
+};
+
+// walks the grammar graph with the same matching rules as the combinators, opaque parts fall back to a full parse
+
+RecognizerResult recognizeAt(const ParserCombinator& parserCombinator, const std::string& str, const int start)
+{
+    const GrammarNode* grammarNode = parserCombinator.getGrammarNode();
+
+    if (grammarNode == nullptr || grammarNode->type == GrammarNode::GrammarNodeType::OPAQUE) {
+        ParserCombinatorResult result = parserCombinator(str, start);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        discardToken(std::get<Token>(result));
+
+        return (int) std::get<Token>(result).width;
+    }
+
+    if (outOfParseBudget(start)) return ParserFailure(start);
+
+    switch (grammarNode->type) {
+        case GrammarNode::GrammarNodeType::SATISFY:
+            reachInputEnd(str, start);
+
+            if (grammarNode->predicate(str[start])) return 1 + skipTrivia(str, start + 1);
+
+            return ParserFailure(start);
+        case GrammarNode::GrammarNodeType::CODE_POINT: {
+            bool reachedEnd;
+
+            int width = grammarNode->codePointClass->match(str, start, reachedEnd);
+
+            if (reachedEnd) parseState.inputEndReached = true;
+
+            if (width == 0) return ParserFailure(start);
+
+            return width + skipTrivia(str, start + width);
+        }
+        case GrammarNode::GrammarNodeType::STRING:
+            if (str.compare(start, grammarNode->stringLiteral.size(), grammarNode->stringLiteral) != 0) {
+                reachInputEnd(str, start + grammarNode->stringLiteral.size() - 1);
+
+                return ParserFailure(start);
+            }
+
+            return (int) grammarNode->stringLiteral.size() + skipTrivia(str, start + grammarNode->stringLiteral.size());
+        case GrammarNode::GrammarNodeType::LITERAL:
+            return matchLiteralRun(grammarNode->stringLiteral, grammarNode->segmentStarts, str, start);
+        case GrammarNode::GrammarNodeType::REGEX: {
+            int rule;
+            bool reachedEnd;
+
+            int width = grammarNode->dfa->match(str, start, rule, reachedEnd);
+
+            if (reachedEnd) parseState.inputEndReached = true;
+
+            if (width == -1) return ParserFailure(start);
+
+            return width + skipTrivia(str, start + width);
+        }
+        case GrammarNode::GrammarNodeType::SKIPPING: {
+            SkipperScope skipperScope(grammarNode->skipper.get());
+
+            int leadingWidth = skipTrivia(str, start);
+
+            RecognizerResult result = recognizeAt(grammarNode->children[1], str, start + leadingWidth);
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+            return leadingWidth + std::get<int>(result);
+        }
+        case GrammarNode::GrammarNodeType::LEXEME:
+        case GrammarNode::GrammarNodeType::SPAN: {
+            RecognizerResult result;
+
+            {
+                SkipperScope skipperScope(nullptr);
+
+                result = recognizeAt(grammarNode->children[0], str, start);
+            }
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+            return std::get<int>(result) + skipTrivia(str, start + std::get<int>(result));
+        }
+        case GrammarNode::GrammarNodeType::REPETITION:
+        case GrammarNode::GrammarNodeType::STRICTLY_REPETITION: {
+            bool strict = grammarNode->type == GrammarNode::GrammarNodeType::STRICTLY_REPETITION;
+
+            const GrammarNode* nestedGrammarNode = grammarNode->children[0].getGrammarNode();
+
+            if (!strict && nestedGrammarNode != nullptr && nestedGrammarNode->type == GrammarNode::GrammarNodeType::CODE_POINT && parseState.skipper == nullptr) {
+                return matchCodePointRun(*nestedGrammarNode->codePointClass, grammarNode->minCount, grammarNode->maxCount, str, start);
+            }
+
+            int tokensFound = 0;
+
+            int scanStart = start;
+
+            while (scanStart != (int) str.size()) {
+                if (tokensFound == grammarNode->maxCount) break;
+
+                RecognizerResult result = recognizeAt(grammarNode->children[0], str, scanStart);
+
+                if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+                    if (strict) return result;
+
+                    break;
+                }
+
+                int width = std::get<int>(result);
+
+                if (width == 0) {
+                    if (strict) return ParserFailure(scanStart);
+
+                    break;
+                }
+
+                tokensFound++;
+
+                scanStart += width;
+            }
+
+            if (tokensFound != grammarNode->maxCount) reachInputEnd(str, scanStart);
+
+            if (strict && scanStart != (int) str.size()) return recognizeAt(grammarNode->children[0], str, scanStart);
+
+            if (tokensFound < grammarNode->minCount) return ParserFailure(scanStart);
+
+            return scanStart - start;
+        }
+        case GrammarNode::GrammarNodeType::SEQUENCE:
+        case GrammarNode::GrammarNodeType::STRICTLY_SEQUENCE: {
+            int scanOffset = 0;
+
+            for (const ParserCombinator& child : grammarNode->children) {
+                RecognizerResult result = recognizeAt(child, str, start + scanOffset);
+
+                if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+                scanOffset += std::get<int>(result);
+            }
+
+            if (grammarNode->type == GrammarNode::GrammarNodeType::STRICTLY_SEQUENCE) reachInputEnd(str, start + scanOffset);
+
+            if (grammarNode->type == GrammarNode::GrammarNodeType::STRICTLY_SEQUENCE && start + scanOffset != (int) str.size()) return ParserFailure(start + scanOffset, "end of input");
+
+            return scanOffset;
+        }
+        case GrammarNode::GrammarNodeType::NEGATE:
+            if (getResultType(recognizeAt(grammarNode->children[0], str, start)) == ParserCombinatorResultType::TOKEN) return ParserFailure(start);
+
+            return 0;
+        case GrammarNode::GrammarNodeType::CHOICE:
+        case GrammarNode::GrammarNodeType::CHOICE_CONCURRENT: {
+            if (grammarNode->children.empty()) return ParserFailure(start);
+
+            int bestWidth = -1;
+            ScratchVector<ParserFailure> parseFailures(parserScratch.parserFailureVectors);
+
+            for (const ParserCombinator& child : grammarNode->children) {
+                RecognizerResult result = recognizeAt(child, str, start);
+
+                if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+                    if (std::get<int>(result) > bestWidth) bestWidth = std::get<int>(result);
+                }
+                else if (bestWidth == -1) {
+                    ParserFailure& parseFailure = std::get<ParserFailure>(result);
+
+                    if (parseFailures.items.empty() || parseFailure.start > parseFailures.items[0].start) {
+                        parseFailures.items.clear();
+
+                        parseFailures.items.push_back(parseFailure);
+                    }
+
+                    else if (parseFailure.start == parseFailures.items[0].start) parseFailures.items.push_back(parseFailure);
+                }
+            }
+
+            if (bestWidth != -1) return bestWidth;
+
+            return ParserFailure::composeFrom(parseFailures.items);
+        }
+        case GrammarNode::GrammarNodeType::ALL_OF: {
+            int largestWidth = 0;
+
+            for (const ParserCombinator& child : grammarNode->children) {
+                RecognizerResult result = recognizeAt(child, str, start);
+
+                if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+                if (std::get<int>(result) > largestWidth) largestWidth = std::get<int>(result);
+            }
+
+            return largestWidth;
+        }
+        case GrammarNode::GrammarNodeType::NONE_OF:
+            for (const ParserCombinator& child : grammarNode->children) {
+                if (getResultType(recognizeAt(child, str, start)) == ParserCombinatorResultType::TOKEN) return ParserFailure(start);
+            }
+
+            return 0;
+        case GrammarNode::GrammarNodeType::NAMED: {
+            RecognizerResult result = recognizeAt(grammarNode->children[0], str, start);
+
+            if (getResultType(result) == ParserCombinatorResultType::TOKEN) return result;
+
+            const ParserFailure& defaultParserFailure = std::get<ParserFailure>(result);
+
+            return ParserFailure(defaultParserFailure.start, defaultParserFailure.name.empty() ? grammarNode->name : defaultParserFailure.name);
+        }
+        case GrammarNode::GrammarNodeType::PROXY:
+            return recognizeAt(*grammarNode->proxiedParserCombinator, str, start);
+        case GrammarNode::GrammarNodeType::DISCARDED:
+            return recognizeAt(grammarNode->children[0], str, start);
+        case GrammarNode::GrammarNodeType::RECOVERABLE: {
+            if (parseState.recoveredFailures == nullptr) return recognizeAt(grammarNode->children[0], str, start);
+
+            ParserCombinatorResult result = parserCombinator(str, start);
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+            discardToken(std::get<Token>(result));
+
+            return (int) std::get<Token>(result).width;
+        }
+        default:
+            return ParserFailure(start);
+    }
+};
+
+RecognizerResult ParserCombinator::recognize(const std::string& str, const int start) const
+{
+    return recognizeAt(*this, str, start);
+};
+
+const GrammarNode* ParserCombinator::getGrammarNode() const
+{
+    return this->grammarNode.get();
+};
+
+ParserCombinator ParserCombinator::repeatedly() const
+{
+    return repetition(*this);
+};
+
+ParserCombinator ParserCombinator::repeatedly(const int minCount) const
+{
+    return repetition(*this, minCount);
+};
+
+ParserCombinator ParserCombinator::repeatedly(const int minCount, const int maxCount) const
+{
+    return repetition(*this, minCount, maxCount);
+};
+
+ParserCombinator ParserCombinator::strictlyRepeatedly() const
+{
+    return strictlyRepetition(*this);
+};
+
+ParserCombinator ParserCombinator::strictlyRepeatedly(const int minCount) const
+{
+    return strictlyRepetition(*this, minCount);
+};
+
+ParserCombinator ParserCombinator::strictlyRepeatedly(const int minCount, const int maxCount) const
+{
+    return strictlyRepetition(*this, minCount, maxCount);
+};
+
+ParserCombinator ParserCombinator::repeatedlyWithDelimeter(const ParserCombinator delimiter) const
+{
+    return sequence({
+        *this,
+        sequence({
+            delimiter,
+            *this
+        }).repeatedly()
+    });
+};
+
+ParserCombinator ParserCombinator::repeatedlyWithDelimeter(const std::string wrapperTokenId, const ParserCombinator delimiter) const
+{
+    return sequence(wrapperTokenId, {
+        *this,
+        sequence({
+            delimiter,
+            *this
+        }).repeatedly()
+    });
+};
+
+ParserCombinator ParserCombinator::strictlyRepeatedlyWithDelimeter(const ParserCombinator delimiter) const
+{
+    return sequence({
+        *this,
+        sequence({
+            delimiter,
+            *this
+        }).strictlyRepeatedly()
+    });
+};
+
+ParserCombinator ParserCombinator::strictlyRepeatedlyWithDelimeter(const std::string wrapperTokenId, const ParserCombinator delimiter) const
+{
+    return sequence(wrapperTokenId, {
+        *this,
+        sequence({
+            delimiter,
+            *this
+        }).strictlyRepeatedly()
+    });
+};
+
+ParserCombinator ParserCombinator::optionally() const
+{
+    return optional(*this);
+};
+
+ParserCombinator ParserCombinator::optionally(const std::string wrapperTokenId) const
+{
+    return optional(wrapperTokenId, *this);
+};
+
+ParserCombinator ParserCombinator::precededBy(const ParserCombinator predecessor) const
+{
+    return precededBy("", predecessor);
+};
+
+ParserCombinator ParserCombinator::precededBy(const std::string wrapperTokenId, const ParserCombinator predecessor) const
+{
+    return sequence(wrapperTokenId, {
+        predecessor,
+        *this
+    });
+};
+
+ParserCombinator ParserCombinator::followedBy(const ParserCombinator predecessor) const
+{
+    return followedBy("", predecessor);
+};
+
+ParserCombinator ParserCombinator::followedBy(const std::string wrapperTokenId, const ParserCombinator predecessor) const
+{
+    return sequence(wrapperTokenId, {
+        *this,
+        predecessor
+    });
+};
+
+ParserCombinator ParserCombinator::surroundedBy(const ParserCombinator neighbor) const
+{
+    return surroundedBy("", neighbor);
+};
+
+ParserCombinator ParserCombinator::surroundedBy(const std::string wrapperTokenId, const ParserCombinator neighbor) const
+{
+    return sequence(wrapperTokenId, {
+        neighbor,
+        *this,
+        neighbor
+    });
+};
+
+ParserCombinator ParserCombinator::named(const std::string name) const
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::NAMED);
+    grammarNode.name = name;
+    grammarNode.children = { *this };
+
+    return ParserCombinator([*this, name] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ParserCombinatorResult result = (*this)(str, start);
+        
+        if (getResultType(result) == ParserCombinatorResultType::TOKEN) return result;
+
+        const ParserFailure& defaultParserFailure = getParserFailureFromResult(result);
+
+        std::string bestName = defaultParserFailure.name.empty() ? name : defaultParserFailure.name;
+
+        return ParserFailure(defaultParserFailure.start, bestName);
+    }, [*this, name] (const std::string& str, const int start, std::vector<Token>& tokens) -> RecognizerResult {
+        RecognizerResult result = this->parseInto(str, start, tokens);
+
+        if (getResultType(result) == ParserCombinatorResultType::TOKEN) return result;
+
+        const ParserFailure& defaultParserFailure = getParserFailureFromResult(result);
+
+        std::string bestName = defaultParserFailure.name.empty() ? name : defaultParserFailure.name;
+
+        return ParserFailure(defaultParserFailure.start, bestName);
+    }, grammarNode);
+};
+
+GrammarNode::GrammarNode(GrammarNodeType type)
+{
+    this->type = type;
+};
+
+std::string GrammarNode::toString() const
+{
+    return toString(0);
+};
+
+std::string GrammarNode::toString(int indent) const
+{
+    static const char* typeNames[] = {
+        "OPAQUE", "SATISFY", "STRING", "LITERAL", "REGEX", "REPETITION", "STRICTLY_REPETITION", "SEQUENCE", "STRICTLY_SEQUENCE",
+        "NEGATE", "CHOICE", "CHOICE_CONCURRENT", "ALL_OF", "NONE_OF", "NAMED", "PROXY", "SKIPPING", "LEXEME", "SPAN", "DISCARDED", "RECOVERABLE", "CODE_POINT"
+    };
+
+    std::string indentStr;
+
+    for (int i = 0;i<indent;i++) indentStr += ' ';
+
+    std::string description = indentStr + typeNames[this->type];
+
+    if (!this->tokenId.empty()) description += " " + this->tokenId;
+
+    if (this->type == GrammarNodeType::NAMED) description += " \"" + this->name + "\"";
+
+    else if (this->type == GrammarNodeType::STRING || this->type == GrammarNodeType::LITERAL || this->type == GrammarNodeType::REGEX) description += " \"" + this->stringLiteral + "\"";
+
+    else if (this->type == GrammarNodeType::REPETITION || this->type == GrammarNodeType::STRICTLY_REPETITION) {
+        description += " [" + std::to_string(this->minCount) + ", " + (this->maxCount == std::numeric_limits<int>::max() ? "inf" : std::to_string(this->maxCount)) + "]";
+    }
+
+    if (this->children.empty()) return description;
+
+    std::string childrenString = "";
+
+    for (int i = 0;i<(int)this->children.size();i++) {
+        const GrammarNode* child = this->children[i].getGrammarNode();
+
+        std::string childString = child == nullptr ? std::string(indent + 4, ' ') + "OPAQUE" : child->toString(indent + 4);
+
+        if (i == 0) childrenString += childString;
+
+        else childrenString += ",\n" + childString;
+    }
+
+    return description + " {\n" + childrenString + "\n" + indentStr + "}";
+};
+
+ParserCombinator ParserCombinator::asSpan(const std::string tokenId) const
+{
+    return span(tokenId, *this);
+};
+
+ParserCombinator satisfy(const Predicate predicate)
+{
+    return satisfy("", predicate);
+};
+
+ParserCombinator satisfy(const std::string tokenId, const Predicate predicate)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::SATISFY);
+    grammarNode.tokenId = tokenId;
+    grammarNode.predicate = predicate;
+
+    const CharacterClass* characterClass = getCharacterClass(predicate);
+
+    // an anonymous leaf vanishes in its parent, so spliced it is only matched
+
+    if (characterClass != nullptr) {
+        std::bitset<256> members = characterClass->members;
+
+        TokenSplicer splicer;
+
+        if (tokenId.empty()) splicer = [members] (const std::string& str, const int start, std::vector<Token>&) -> RecognizerResult {
+            reachInputEnd(str, start);
+
+            if (members[(unsigned char) str[start]]) return 1 + skipTrivia(str, start + 1);
+
+            else return ParserFailure(start);
+        };
+
+        return ParserCombinator([tokenId, members] (const std::string& str, const int start) -> ParserCombinatorResult {
+            reachInputEnd(str, start);
+
+            const char& c = str[start];
+
+            if (members[(unsigned char) c]) return createToken(tokenId, std::string(1, c), start, 1 + skipTrivia(str, start + 1));
+
+            else return ParserFailure(start);
+        }, splicer, grammarNode);
+    }
+
+    TokenSplicer splicer;
+
+    if (tokenId.empty()) splicer = [predicate] (const std::string& str, const int start, std::vector<Token>&) -> RecognizerResult {
+        reachInputEnd(str, start);
+
+        if (predicate(str[start])) return 1 + skipTrivia(str, start + 1);
+
+        else return ParserFailure(start);
+    };
+
+    return ParserCombinator([tokenId, predicate] (const std::string& str, const int start) -> ParserCombinatorResult {
+        reachInputEnd(str, start);
+
+        const char& c = str[start];
+
+        if (predicate(c)) return createToken(tokenId, std::string(1, c), start, 1 + skipTrivia(str, start + 1));
+
+        else return ParserFailure(start);
+    }, splicer, grammarNode);
+};
+
+ParserCombinator satisfyCodePoint(const CodePointPredicate predicate)
+{
+    return satisfyCodePoint("", predicate);
+};
+
+ParserCombinator satisfyCodePoint(const std::string tokenId, const CodePointPredicate predicate)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::CODE_POINT);
+    grammarNode.tokenId = tokenId;
+    grammarNode.codePointClass = std::make_shared<const CodePointClass>(predicate);
+
+    std::shared_ptr<const CodePointClass> codePointClass = grammarNode.codePointClass;
+
+    TokenSplicer splicer;
+
+    if (tokenId.empty()) splicer = [codePointClass] (const std::string& str, const int start, std::vector<Token>&) -> RecognizerResult {
+        bool reachedEnd;
+
+        int width = codePointClass->match(str, start, reachedEnd);
+
+        if (reachedEnd) parseState.inputEndReached = true;
+
+        if (width == 0) return ParserFailure(start);
+
+        return width + skipTrivia(str, start + width);
+    };
+
+    return ParserCombinator([tokenId, codePointClass] (const std::string& str, const int start) -> ParserCombinatorResult {
+        bool reachedEnd;
+
+        int width = codePointClass->match(str, start, reachedEnd);
+
+        if (reachedEnd) parseState.inputEndReached = true;
+
+        if (width == 0) return ParserFailure(start);
+
+        return createToken(tokenId, str.substr(start, width), start, width + skipTrivia(str, start + width));
+    }, splicer, grammarNode);
+};
+
+ParserCombinator repetition(const ParserCombinator nestedTokenGenerator)
+{
+    return repetition("", nestedTokenGenerator);
+};
+
+ParserCombinator repetition(const ParserCombinator nestedTokenGenerator, const int minCount)
+{
+    return repetition("", nestedTokenGenerator, minCount);
+};
+
+ParserCombinator repetition(const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+{
+    return repetition("", nestedTokenGenerator, minCount, maxCount);
+};
+
+ParserCombinator repetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator)
+{
+    return repetition(tokenId, nestedTokenGenerator, 0, std::numeric_limits<int>::max());
+};
+
+ParserCombinator repetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount)
+{
+    return repetition(tokenId, nestedTokenGenerator, minCount, std::numeric_limits<int>::max());
+};
+
+ParserCombinator repetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::REPETITION);
+    grammarNode.tokenId = tokenId;
+    grammarNode.minCount = minCount;
+    grammarNode.maxCount = maxCount;
+    grammarNode.children = { nestedTokenGenerator };
+
+    // an anonymous code point leaf builds no tokens, so without trivia its repetition is one run over the input
+
+    const GrammarNode* nestedGrammarNode = nestedTokenGenerator.getGrammarNode();
+
+    std::shared_ptr<const CodePointClass> codePointRun;
+
+    if (nestedGrammarNode != nullptr && nestedGrammarNode->type == GrammarNode::GrammarNodeType::CODE_POINT && nestedGrammarNode->tokenId.empty()) codePointRun = nestedGrammarNode->codePointClass;
+
+    auto spliceRepetition = [nestedTokenGenerator, minCount, maxCount, codePointRun] (const std::string& str, const int start, std::vector<Token>& tokens) -> RecognizerResult {
+        if (codePointRun && parseState.skipper == nullptr) return matchCodePointRun(*codePointRun, minCount, maxCount, str, start);
+
+        int firstToken = tokens.size();
+
+        int tokensFound = 0;
+    
+        int scanStart = start;
+
+        while (scanStart != (int) str.size()) {
+            if (tokensFound == maxCount) break;
+
+            int itemTokens = tokens.size();
+
+            RecognizerResult result = nestedTokenGenerator.parseInto(str, scanStart, tokens);
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) break;
+
+            int width = std::get<int>(result);
+
+            if (width == 0) {
+                discardTokens(tokens, itemTokens);
+
+                break;
+            }
+
+            tokensFound++;
+
+            scanStart += width;
+        }
+
+        if (tokensFound != maxCount) reachInputEnd(str, scanStart);
+
+        if (tokensFound < minCount) {
+            discardTokens(tokens, firstToken);
+
+            return ParserFailure(scanStart);
+        }
+
+        else return scanStart - start;
+    };
+
+    return ParserCombinator([tokenId, spliceRepetition] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ScratchVector<Token> nestedTokens(parserScratch.tokenVectors);
+
+        RecognizerResult result = spliceRepetition(str, start, nestedTokens.items);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        return createToken(tokenId, takeTokens(nestedTokens.items), start, std::get<int>(result));
+    }, tokenId.empty() ? TokenSplicer(spliceRepetition) : TokenSplicer(), grammarNode);
+};
+
+ParserCombinator strictlyRepetition(const ParserCombinator nestedTokenGenerator)
+{
+    return strictlyRepetition("", nestedTokenGenerator);
+};
+
+ParserCombinator strictlyRepetition(const ParserCombinator nestedTokenGenerator, const int minCount)
+{
+    return strictlyRepetition("", nestedTokenGenerator, minCount);
+};
+
+ParserCombinator strictlyRepetition(const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+{
+    return strictlyRepetition("", nestedTokenGenerator, minCount, maxCount);
+};
+
+ParserCombinator strictlyRepetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator)
+{
+    return strictlyRepetition(tokenId, nestedTokenGenerator, 0, std::numeric_limits<int>::max());
+};
+
+ParserCombinator strictlyRepetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount)
+{
+    return strictlyRepetition(tokenId, nestedTokenGenerator, minCount, std::numeric_limits<int>::max());
+};
+
+ParserCombinator strictlyRepetition(const std::string tokenId, const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::STRICTLY_REPETITION);
+    grammarNode.tokenId = tokenId;
+    grammarNode.minCount = minCount;
+    grammarNode.maxCount = maxCount;
+    grammarNode.children = { nestedTokenGenerator };
+
+    // the items up to the end of input or maxCount, a stop short of the end is left to the caller
+
+    auto spliceItems = [nestedTokenGenerator, maxCount] (const std::string& str, const int start, std::vector<Token>& tokens, int& tokensFound) -> RecognizerResult {
+        int firstToken = tokens.size();
+    
+        int scanStart = start;
+
+        while (scanStart != (int) str.size()) {
+            if (tokensFound == maxCount) break;
+
+            RecognizerResult result = nestedTokenGenerator.parseInto(str, scanStart, tokens);
+
+            if (getResultType(result) == ParserCombinatorResultType::TOKEN && std::get<int>(result) == 0) result = ParserFailure(scanStart);
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+                discardTokens(tokens, firstToken);
+
+                return result;
+            }
+
+            tokensFound++;
+
+            scanStart += std::get<int>(result);
+        }
+
+        if (tokensFound != maxCount) reachInputEnd(str, scanStart);
+
+        return scanStart - start;
+    };
+
+    TokenSplicer splicer;
+
+    if (tokenId.empty()) splicer = [nestedTokenGenerator, minCount, spliceItems] (const std::string& str, const int start, std::vector<Token>& tokens) -> RecognizerResult {
+        int firstToken = tokens.size();
+
+        int tokensFound = 0;
+
+        RecognizerResult result = spliceItems(str, start, tokens, tokensFound);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+        int scanStart = start + std::get<int>(result);
+
+        if (scanStart != (int) str.size() || tokensFound < minCount) discardTokens(tokens, firstToken);
+        
+        if (scanStart != (int) str.size()) return nestedTokenGenerator.parseInto(str, scanStart, tokens);
+
+        else if (tokensFound < minCount) return ParserFailure(scanStart);
+
+        else return result;
+    };
+
+    return ParserCombinator([tokenId, nestedTokenGenerator, minCount, spliceItems] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ScratchVector<Token> nestedTokens(parserScratch.tokenVectors);
+
+        int tokensFound = 0;
+
+        RecognizerResult result = spliceItems(str, start, nestedTokens.items, tokensFound);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        int scanStart = start + std::get<int>(result);
+        
+        if (scanStart != (int) str.size()) {
+            discardTokens(nestedTokens.items, 0);
+
+            return nestedTokenGenerator(str, scanStart);
+        }
+
+        else if (tokensFound < minCount) return ParserFailure(scanStart);
+
+        else return createToken(tokenId, takeTokens(nestedTokens.items), start, scanStart - start);
+    }, splicer, grammarNode);
+};
+
+ParserCombinator optional(const ParserCombinator tokenGenerator)
+{
+    return optional("", tokenGenerator);
+};
+
+ParserCombinator optional(const std::string tokenId, const ParserCombinator tokenGenerator)
+{
+    return repetition(tokenId, tokenGenerator, 0, 1);
+};
+
+ParserCombinator sequence(const std::vector<ParserCombinator> tokenGeneratorSequence)
+{
+    return sequence("", tokenGeneratorSequence);
+};
+
+ParserCombinator sequence(const std::string tokenId, const std::vector<ParserCombinator> tokenGeneratorSequence)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::SEQUENCE);
+    grammarNode.tokenId = tokenId;
+    grammarNode.children = tokenGeneratorSequence;
+
+    auto spliceSequence = [tokenGeneratorSequence] (const std::string& str, const int start, std::vector<Token>& tokens) -> RecognizerResult {
+        int firstToken = tokens.size();
+
+        int scanOffset = 0;
+
+        for (const ParserCombinator& tokenGenerator : tokenGeneratorSequence) {
+            RecognizerResult result = tokenGenerator.parseInto(str, start + scanOffset, tokens);
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+                discardTokens(tokens, firstToken);
+
+                return result;
+            }
+
+            scanOffset += std::get<int>(result);
+        }
+
+        return scanOffset;
+    };
+
+    return ParserCombinator([tokenId, spliceSequence] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ScratchVector<Token> sequenceTokens(parserScratch.tokenVectors);
+
+        RecognizerResult result = spliceSequence(str, start, sequenceTokens.items);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        return createToken(tokenId, takeTokens(sequenceTokens.items), start, std::get<int>(result));
+    }, tokenId.empty() ? TokenSplicer(spliceSequence) : TokenSplicer(), grammarNode);
+};
+
+ParserCombinator strictlySequence(const std::vector<ParserCombinator> tokenGeneratorSequence) {
+    return strictlySequence("", tokenGeneratorSequence);
+};
+
+ParserCombinator strictlySequence(const std::string tokenId, const std::vector<ParserCombinator> tokenGeneratorSequence) {
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::STRICTLY_SEQUENCE);
+    grammarNode.tokenId = tokenId;
+    grammarNode.children = tokenGeneratorSequence;
+
+    ParserCombinator nonStrictSequence = sequence(tokenId, tokenGeneratorSequence);
+
+    TokenSplicer splicer;
+
+    if (tokenId.empty()) splicer = [nonStrictSequence] (const std::string& str, const int start, std::vector<Token>& tokens) -> RecognizerResult {
+        int firstToken = tokens.size();
+
+        RecognizerResult result = nonStrictSequence.parseInto(str, start, tokens);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+        int end = start + std::get<int>(result);
+
+        reachInputEnd(str, end);
+
+        if (end == (int) str.size()) return result;
+
+        discardTokens(tokens, firstToken);
+
+        return ParserFailure(end, "end of input");
+    };
+
+    return ParserCombinator([nonStrictSequence] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ParserCombinatorResult result = nonStrictSequence(str, start);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+        const Token& token = getTokenFromResult(result);
+
+        reachInputEnd(str, token.start + token.width);
+
+        if (token.start + token.width == (int) str.size()) return result;
+
+        discardToken(token);
+
+        return ParserFailure(token.start + token.width, "end of input");
+    }, splicer, grammarNode);
+};
+
+ParserCombinator string(const std::string stringLiteral)
+{
+    return string("", stringLiteral);
+};
+
+ParserCombinator string(const std::string tokenId, const std::string stringLiteral)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::STRING);
+    grammarNode.tokenId = tokenId;
+    grammarNode.stringLiteral = stringLiteral;
+
+    TokenSplicer splicer;
+
+    if (tokenId.empty()) splicer = [stringLiteral] (const std::string& str, const int start, std::vector<Token>&) -> RecognizerResult {
+        if (str.compare(start, stringLiteral.size(), stringLiteral) != 0) {
+            reachInputEnd(str, start + stringLiteral.size() - 1);
+
+            return ParserFailure(start);
+        }
+
+        else return (int) stringLiteral.size() + skipTrivia(str, start + stringLiteral.size());
+    };
+
+    return ParserCombinator([tokenId, stringLiteral] (const std::string& str, const int start) -> ParserCombinatorResult {
+        if (str.compare(start, stringLiteral.size(), stringLiteral) != 0) {
+            reachInputEnd(str, start + stringLiteral.size() - 1);
+
+            return ParserFailure(start);
+        }
+        
+        else return createToken(tokenId, stringLiteral, start, stringLiteral.size() + skipTrivia(str, start + stringLiteral.size()));
+    }, splicer, grammarNode);
+};
+
+ParserCombinator regex(const std::string pattern)
+{
+    return regex("", pattern);
+};
+
+// compiled to a minimized dfa once here, matching is a single table walk that keeps the longest match
+
+ParserCombinator regex(const std::string tokenId, const std::string pattern)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::REGEX);
+    grammarNode.tokenId = tokenId;
+    grammarNode.stringLiteral = pattern;
+
+    std::shared_ptr<const DFA> dfa = std::make_shared<const DFA>(DFA::compile({ pattern }));
+
+    grammarNode.dfa = dfa;
+
+    TokenSplicer splicer;
+
+    if (tokenId.empty()) splicer = [dfa] (const std::string& str, const int start, std::vector<Token>&) -> RecognizerResult {
+        int rule;
+        bool reachedEnd;
+
+        int width = dfa->match(str, start, rule, reachedEnd);
+
+        if (reachedEnd) parseState.inputEndReached = true;
+
+        if (width == -1) return ParserFailure(start);
+
+        else return width + skipTrivia(str, start + width);
+    };
+
+    return ParserCombinator([tokenId, dfa] (const std::string& str, const int start) -> ParserCombinatorResult {
+        int rule;
+        bool reachedEnd;
+
+        int width = dfa->match(str, start, rule, reachedEnd);
+
+        if (reachedEnd) parseState.inputEndReached = true;
+
+        if (width == -1) return ParserFailure(start);
+
+        else return createToken(tokenId, str.substr(start, width), start, width + skipTrivia(str, start + width));
+    }, splicer, grammarNode);
+};
+
+ParserCombinator negate(const ParserCombinator tokenGenerator)
+{
+    return negate("", tokenGenerator);
+};
+
+ParserCombinator negate(const std::string tokenId, const ParserCombinator tokenGenerator)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::NEGATE);
+    grammarNode.tokenId = tokenId;
+    grammarNode.children = { tokenGenerator };
+
+    return ParserCombinator([tokenId, tokenGenerator] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ParserCombinatorResult result = tokenGenerator(str, start);
+
+        if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+            discardToken(std::get<Token>(result));
+
+            return ParserFailure(start);
+        }
+
+        else return createToken(tokenId, std::vector<Token>(), start, 0);
+    }, grammarNode);
+};
+
+ParserCombinator choice(const std::vector<ParserCombinator> tokenGeneratorChoices)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::CHOICE);
+    grammarNode.children = tokenGeneratorChoices;
+
+    return ParserCombinator([tokenGeneratorChoices] (const std::string& str, const int start) -> ParserCombinatorResult {
+        if (tokenGeneratorChoices.empty()) return ParserFailure(start);
+
+        bool foundToken = false;
+        ScratchVector<ParserFailure> parseFailures(parserScratch.parserFailureVectors);
+        Token bestToken;
+
+        // only the chosen alternative's recoveries stand
+
+        std::vector<ParserFailure>* recoveredFailures = parseState.recoveredFailures;
+        int firstRecoveredFailure = recoveredFailures == nullptr ? 0 : recoveredFailures->size();
+        std::vector<ParserFailure> bestRecoveredFailures;
+
+        for (const ParserCombinator& tokenGenerator : tokenGeneratorChoices) {
+            ParserCombinatorResult result = tokenGenerator(str, start);
+
+            if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+                Token& token = std::get<Token>(result);
+
+                if (!foundToken || token.width > bestToken.width) {
+                    if (foundToken) discardToken(bestToken);
+
+                    foundToken = true;
+
+                    bestToken = std::move(token);
+
+                    if (recoveredFailures != nullptr) bestRecoveredFailures.assign(recoveredFailures->begin() + firstRecoveredFailure, recoveredFailures->end());
+                }
+
+                else discardToken(token);
+
+                if (recoveredFailures != nullptr) recoveredFailures->erase(recoveredFailures->begin() + firstRecoveredFailure, recoveredFailures->end());
+            }
+            else if (!foundToken) {
+                ParserFailure& parseFailure = std::get<ParserFailure>(result);
+
+                if (parseFailures.items.empty() || parseFailure.start > parseFailures.items[0].start) {
+                    parseFailures.items.clear();
+
+                    parseFailures.items.push_back(std::move(parseFailure));
+                }
+
+                else if (parseFailure.start == parseFailures.items[0].start) parseFailures.items.push_back(std::move(parseFailure));
+            }
+        }
+
+        if (recoveredFailures != nullptr) recoveredFailures->insert(recoveredFailures->end(), bestRecoveredFailures.begin(), bestRecoveredFailures.end());
+
+        if (foundToken) return bestToken;
+
+        else return ParserFailure::composeFrom(parseFailures.items);
+    }, grammarNode);
+};
+
+ParserCombinator choiceConcurrent(const std::vector<ParserCombinator> tokenGeneratorChoices)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::CHOICE_CONCURRENT);
+    grammarNode.children = tokenGeneratorChoices;
+
+    return ParserCombinator([tokenGeneratorChoices] (const std::string& str, const int start) -> ParserCombinatorResult {
+        if (tokenGeneratorChoices.empty()) return ParserFailure(start);
+        
+        std::vector<std::future<ParserCombinatorResult>> tokenGeneratorThreads;
+
+        ParseState callerParseState = forkParseState();
+
+        // each alternative recovers into its own list, only the chosen one's is kept
+
+        std::vector<std::vector<ParserFailure>> alternativeRecoveredFailures(tokenGeneratorChoices.size());
+        std::vector<char> alternativeReachedInputEnd(tokenGeneratorChoices.size(), false);
+        std::vector<ParserFailure> alternativeFarthestFailures(tokenGeneratorChoices.size(), ParserFailure(-1));
+
+        for (int i = 0;i<(int)tokenGeneratorChoices.size();i++) {
+            const ParserCombinator& tokenGenerator = tokenGeneratorChoices[i];
+            std::vector<ParserFailure>* recoveredFailures = callerParseState.recoveredFailures == nullptr ? nullptr : &alternativeRecoveredFailures[i];
+            char* reachedInputEnd = &alternativeReachedInputEnd[i];
+            ParserFailure* farthestFailure = callerParseState.farthestFailure == nullptr ? nullptr : &alternativeFarthestFailures[i];
+
+            tokenGeneratorThreads.push_back(std::async(std::launch::async, [&str, start, &tokenGenerator, callerParseState, recoveredFailures, reachedInputEnd, farthestFailure] {
+                parseState = callerParseState;
+                parseState.recoveredFailures = recoveredFailures;
+                parseState.farthestFailure = farthestFailure;
+                parseState.inputEndReached = false;
+
+                ParserCombinatorResult result = tokenGenerator(str, start);
+
+                if (parseState.budget != nullptr) settleParseBudget();
+
+                *reachedInputEnd = parseState.inputEndReached;
+
+                return result;
+            }));
+        }
+
+        std::vector<ParserCombinatorResult> tokenGeneratorResults;
+
+        bool foundToken = false;
+        ScratchVector<ParserFailure> parseFailures(parserScratch.parserFailureVectors);
+        Token bestToken;
+        int bestAlternative = 0;
+
+        for (int i = 0;i<(int)tokenGeneratorThreads.size();i++) {
+            ParserCombinatorResult result = tokenGeneratorThreads[i].get();
+
+            if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+                Token& token = std::get<Token>(result);
+
+                if (!foundToken || token.width > bestToken.width) {
+                    if (foundToken) discardToken(bestToken);
+
+                    foundToken = true;
+
+                    bestToken = std::move(token);
+                    bestAlternative = i;
+                }
+
+                else discardToken(token);
+            }
+            else if (!foundToken) {
+                ParserFailure& parseFailure = std::get<ParserFailure>(result);
+
+                if (parseFailures.items.empty() || parseFailure.start > parseFailures.items[0].start) {
+                    parseFailures.items.clear();
+
+                    parseFailures.items.push_back(std::move(parseFailure));
+                }
+
+                else if (parseFailure.start == parseFailures.items[0].start) parseFailures.items.push_back(std::move(parseFailure));
+            }
+        }
+
+        for (char reachedInputEnd : alternativeReachedInputEnd) if (reachedInputEnd) parseState.inputEndReached = true;
+
+        for (const ParserFailure& farthestFailure : alternativeFarthestFailures) if (farthestFailure.start != -1) noteFarthestFailure(farthestFailure);
+
+        if (foundToken && parseState.recoveredFailures != nullptr) {
+            std::vector<ParserFailure>& chosenRecoveredFailures = alternativeRecoveredFailures[bestAlternative];
+
+            parseState.recoveredFailures->insert(parseState.recoveredFailures->end(), chosenRecoveredFailures.begin(), chosenRecoveredFailures.end());
+        }
+
+        if (foundToken) return bestToken;
+
+        else return ParserFailure::composeFrom(parseFailures.items);
+    }, grammarNode);
+};
+
+ParserCombinator allOf(const std::string tokenId, const std::vector<ParserCombinator> tokenGeneratorRequirements)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::ALL_OF);
+    grammarNode.tokenId = tokenId;
+    grammarNode.children = tokenGeneratorRequirements;
+
+    auto spliceRequirements = [tokenGeneratorRequirements] (const std::string& str, const int start, std::vector<Token>& tokens) -> RecognizerResult {
+        int firstToken = tokens.size();
+        int largestTokenWidth = 0;
+
+        for (const ParserCombinator& tokenGeneratorRequirement : tokenGeneratorRequirements) {
+            RecognizerResult result = tokenGeneratorRequirement.parseInto(str, start, tokens);
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+                discardTokens(tokens, firstToken);
+
+                return result;
+            }
+
+            if (std::get<int>(result) > largestTokenWidth) largestTokenWidth = std::get<int>(result);
+        }
+
+        return largestTokenWidth;
+    };
+
+    return ParserCombinator([tokenId, spliceRequirements] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ScratchVector<Token> tokens(parserScratch.tokenVectors);
+
+        RecognizerResult result = spliceRequirements(str, start, tokens.items);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        return createToken(tokenId, takeTokens(tokens.items), start, std::get<int>(result));
+    }, tokenId.empty() ? TokenSplicer(spliceRequirements) : TokenSplicer(), grammarNode);
+};
+
+ParserCombinator noneOf(const std::vector<ParserCombinator> tokenGeneratorRequirements)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::NONE_OF);
+    grammarNode.children = tokenGeneratorRequirements;
+
+    return ParserCombinator([tokenGeneratorRequirements] (const std::string& str, const int start) -> ParserCombinatorResult {
+        for (const ParserCombinator& tokenGeneratorRequirement : tokenGeneratorRequirements) {
+            ParserCombinatorResult result = tokenGeneratorRequirement(str, start);
+
+            if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+                discardToken(std::get<Token>(result));
+
+                return ParserFailure(start);
+            }
+        }
+
+        return createToken("", std::vector<Token>(), start, 0);
+    }, grammarNode);
+};
+
+ParserCombinator proxyParserCombinator(const ParserCombinator* parserCombinatorPointer)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::PROXY);
+    grammarNode.proxiedParserCombinator = parserCombinatorPointer;
+
+    return ParserCombinator([parserCombinatorPointer] (const std::string& str, const int start) -> ParserCombinatorResult {
+        return (*parserCombinatorPointer)(str, start);
+    }, [parserCombinatorPointer] (const std::string& str, const int start, std::vector<Token>& tokens) -> RecognizerResult {
+        return parserCombinatorPointer->parseInto(str, start, tokens);
+    }, grammarNode);
+};
+
+// matches its child for the width alone, the anonymous empty token it returns vanishes in the parent
+
+ParserCombinator discarded(const ParserCombinator parserCombinator)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::DISCARDED);
+    grammarNode.children = { parserCombinator };
+
+    return ParserCombinator([parserCombinator] (const std::string& str, const int start) -> ParserCombinatorResult {
+        RecognizerResult result = parserCombinator.recognize(str, start);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        return createToken("", std::vector<Token>(), start, std::get<int>(result));
+    }, [parserCombinator] (const std::string& str, const int start, std::vector<Token>&) -> RecognizerResult {
+        return parserCombinator.recognize(str, start);
+    }, grammarNode);
+};
+
+// fused run of anonymous single char satisfy and string leaves, failures are still reported where the original leaf started
+// and trivia is still skipped after every leaf
+
+ParserCombinator literalRun(const std::string stringLiteral, const std::vector<int> segmentStarts)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::LITERAL);
+    grammarNode.stringLiteral = stringLiteral;
+    grammarNode.segmentStarts = segmentStarts;
+
+    return ParserCombinator([stringLiteral, segmentStarts] (const std::string& str, const int start) -> ParserCombinatorResult {
+        RecognizerResult result = matchLiteralRun(stringLiteral, segmentStarts, str, start);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        return createToken("", stringLiteral, start, std::get<int>(result));
+    }, [stringLiteral, segmentStarts] (const std::string& str, const int start, std::vector<Token>&) -> RecognizerResult {
+        return matchLiteralRun(stringLiteral, segmentStarts, str, start);
+    }, grammarNode);
+};
+
+typedef std::map<std::pair<const GrammarNode*, bool>, ParserCombinator> OptimizedGrammarNodes;
+
+ParserCombinator optimizeGrammar(const ParserCombinator& parserCombinator, const bool spliced, OptimizedGrammarNodes& optimized);
+
+inline bool isLiteralLeaf(const GrammarNode* grammarNode)
+{
+    if (grammarNode == nullptr || !grammarNode->tokenId.empty()) return false;
+
+    if (grammarNode->type == GrammarNode::GrammarNodeType::STRING || grammarNode->type == GrammarNode::GrammarNodeType::LITERAL) return true;
+
+    if (grammarNode->type != GrammarNode::GrammarNodeType::SATISFY) return false;
+
+    const CharacterClass* characterClass = getCharacterClass(grammarNode->predicate);
+
+    return characterClass != nullptr && characterClass->members.count() == 1 && !characterClass->members[0];
+};
+
+inline void appendLiteralLeaf(std::string& stringLiteral, std::vector<int>& segmentStarts, const GrammarNode* grammarNode)
+{
+    if (grammarNode->type == GrammarNode::GrammarNodeType::SATISFY) {
+        const std::bitset<256>& members = getCharacterClass(grammarNode->predicate)->members;
+
+        for (int c = 0;c<256;c++) if (members[c]) {
+            segmentStarts.push_back(stringLiteral.size());
+
+            stringLiteral += (char) c;
+        }
+    }
+    else if (grammarNode->type == GrammarNode::GrammarNodeType::STRING) {
+        segmentStarts.push_back(stringLiteral.size());
+
+        stringLiteral += grammarNode->stringLiteral;
+    }
+    else {
+        for (int segmentStart : grammarNode->segmentStarts) segmentStarts.push_back(stringLiteral.size() + segmentStart);
+
+        stringLiteral += grammarNode->stringLiteral;
+    }
+};
+
+// children of a sequence are spliced into it, so anonymous nested sequences flatten and literal leaves fuse
+
+std::vector<ParserCombinator> optimizeSequenceChildren(const std::vector<ParserCombinator>& children, OptimizedGrammarNodes& optimized)
+{
+    std::vector<ParserCombinator> flattenedChildren;
+
+    for (const ParserCombinator& child : children) {
+        ParserCombinator optimizedChild = optimizeGrammar(child, true, optimized);
+
+        const GrammarNode* grammarNode = optimizedChild.getGrammarNode();
+
+        if (grammarNode != nullptr && grammarNode->type == GrammarNode::GrammarNodeType::SEQUENCE && grammarNode->tokenId.empty()) {
+            flattenedChildren.insert(flattenedChildren.end(), grammarNode->children.begin(), grammarNode->children.end());
+        }
+        else flattenedChildren.push_back(optimizedChild);
+    }
+
+    std::vector<ParserCombinator> fusedChildren;
+
+    for (int i = 0;i<(int)flattenedChildren.size();) {
+        int runEnd = i;
+
+        while (runEnd < (int) flattenedChildren.size() && isLiteralLeaf(flattenedChildren[runEnd].getGrammarNode())) runEnd++;
+
+        if (runEnd - i < 2) {
+            fusedChildren.push_back(flattenedChildren[i]);
+
+            i++;
+
+            continue;
+        }
+
+        std::string stringLiteral;
+        std::vector<int> segmentStarts;
+
+        for (;i<runEnd;i++) appendLiteralLeaf(stringLiteral, segmentStarts, flattenedChildren[i].getGrammarNode());
+
+        fusedChildren.push_back(literalRun(stringLiteral, segmentStarts));
+    }
+
+    return fusedChildren;
+};
+
+// adjacent satisfy alternatives with the same token id collapse into one satisfy over the union of their predicates
+
+std::vector<ParserCombinator> optimizeChoiceChildren(const std::vector<ParserCombinator>& children, const bool spliced, OptimizedGrammarNodes& optimized)
+{
+    std::vector<ParserCombinator> mergedChildren;
+
+    std::vector<Predicate> predicates;
+    std::string predicatesTokenId;
+
+    auto flushPredicates = [&] () {
+        if (predicates.size() == 1) mergedChildren.push_back(satisfy(predicatesTokenId, predicates[0]));
+
+        else if (predicates.size() > 1) mergedChildren.push_back(satisfy(predicatesTokenId, anyOf(predicates)));
+
+        predicates.clear();
+    };
+
+    for (const ParserCombinator& child : children) {
+        ParserCombinator optimizedChild = optimizeGrammar(child, spliced, optimized);
+
+        const GrammarNode* grammarNode = optimizedChild.getGrammarNode();
+
+        if (grammarNode == nullptr || grammarNode->type != GrammarNode::GrammarNodeType::SATISFY) {
+            flushPredicates();
+
+            mergedChildren.push_back(optimizedChild);
+
+            continue;
+        }
+
+        if (!predicates.empty() && grammarNode->tokenId != predicatesTokenId) flushPredicates();
+
+        predicatesTokenId = grammarNode->tokenId;
+
+        predicates.push_back(grammarNode->predicate);
+    }
+
+    flushPredicates();
+
+    return mergedChildren;
+};
+
+std::vector<ParserCombinator> optimizeChildren(const std::vector<ParserCombinator>& children, const bool spliced, OptimizedGrammarNodes& optimized)
+{
+    std::vector<ParserCombinator> optimizedChildren;
+
+    for (const ParserCombinator& child : children) optimizedChildren.push_back(optimizeGrammar(child, spliced, optimized));
+
+    return optimizedChildren;
+};
+
+// spliced means the result is only ever passed through addChildToken, where an anonymous single child sequence is invisible
+
+ParserCombinator optimizeGrammar(const ParserCombinator& parserCombinator, const bool spliced, OptimizedGrammarNodes& optimized)
+{
+    const GrammarNode* grammarNode = parserCombinator.getGrammarNode();
+
+    if (grammarNode == nullptr) return parserCombinator;
+
+    auto memoized = optimized.find({ grammarNode, spliced });
+
+    if (memoized != optimized.end()) return memoized->second;
+
+    ParserCombinator optimizedParserCombinator = parserCombinator;
+
+    switch (grammarNode->type) {
+        case GrammarNode::GrammarNodeType::SEQUENCE: {
+            std::vector<ParserCombinator> children = optimizeSequenceChildren(grammarNode->children, optimized);
+
+            if (spliced && grammarNode->tokenId.empty() && children.size() == 1) optimizedParserCombinator = children[0];
+
+            else optimizedParserCombinator = sequence(grammarNode->tokenId, children);
+
+            break;
+        }
+        case GrammarNode::GrammarNodeType::STRICTLY_SEQUENCE:
+            optimizedParserCombinator = strictlySequence(grammarNode->tokenId, optimizeSequenceChildren(grammarNode->children, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::REPETITION:
+            optimizedParserCombinator = repetition(grammarNode->tokenId, optimizeGrammar(grammarNode->children[0], true, optimized), grammarNode->minCount, grammarNode->maxCount);
+
+            break;
+        case GrammarNode::GrammarNodeType::STRICTLY_REPETITION:
+            optimizedParserCombinator = strictlyRepetition(grammarNode->tokenId, optimizeGrammar(grammarNode->children[0], true, optimized), grammarNode->minCount, grammarNode->maxCount);
+
+            break;
+        case GrammarNode::GrammarNodeType::NEGATE:
+            optimizedParserCombinator = negate(grammarNode->tokenId, optimizeGrammar(grammarNode->children[0], true, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::CHOICE:
+            optimizedParserCombinator = choice(optimizeChoiceChildren(grammarNode->children, spliced, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::CHOICE_CONCURRENT:
+            optimizedParserCombinator = choiceConcurrent(optimizeChildren(grammarNode->children, spliced, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::ALL_OF:
+            optimizedParserCombinator = allOf(grammarNode->tokenId, optimizeChildren(grammarNode->children, true, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::NONE_OF:
+            optimizedParserCombinator = noneOf(optimizeChildren(grammarNode->children, true, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::NAMED:
+            optimizedParserCombinator = optimizeGrammar(grammarNode->children[0], spliced, optimized).named(grammarNode->name);
+
+            break;
+        case GrammarNode::GrammarNodeType::SKIPPING:
+            optimizedParserCombinator = skipping(optimizeGrammar(grammarNode->children[0], true, optimized), optimizeGrammar(grammarNode->children[1], spliced, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::LEXEME:
+            optimizedParserCombinator = lexeme(optimizeGrammar(grammarNode->children[0], spliced, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::SPAN:
+            optimizedParserCombinator = span(grammarNode->tokenId, optimizeGrammar(grammarNode->children[0], true, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::DISCARDED:
+            optimizedParserCombinator = discarded(optimizeGrammar(grammarNode->children[0], true, optimized));
+
+            break;
+        case GrammarNode::GrammarNodeType::RECOVERABLE:
+            optimizedParserCombinator = recoverable(grammarNode->tokenId, optimizeGrammar(grammarNode->children[0], spliced, optimized), optimizeGrammar(grammarNode->children[1], true, optimized));
+
+            break;
+        default:
+            break;
+    }
+
+    optimized.insert({ { grammarNode, spliced }, optimizedParserCombinator });
+
+    return optimizedParserCombinator;
+};
+
+// proxies keep pointing at their original target, reassign recursive rules to their optimized form so the proxies follow
+
+ParserCombinator optimize(const ParserCombinator parserCombinator)
+{
+    OptimizedGrammarNodes optimized;
+
+    return optimizeGrammar(parserCombinator, false, optimized);
+};
+
+ParserCombinator skipping(const ParserCombinator trivia, const ParserCombinator parserCombinator)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::SKIPPING);
+    grammarNode.children = { trivia, parserCombinator };
+    grammarNode.skipper = std::make_shared<const Skipper>(trivia);
+
+    std::shared_ptr<const Skipper> skipper = grammarNode.skipper;
+
+    return ParserCombinator([skipper, parserCombinator] (const std::string& str, const int start) -> ParserCombinatorResult {
+        SkipperScope skipperScope(skipper.get());
+
+        int leadingWidth = skipTrivia(str, start);
+
+        ParserCombinatorResult result = parserCombinator(str, start + leadingWidth);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+        Token& token = std::get<Token>(result);
+
+        token.start = start;
+        token.width += leadingWidth;
+
+        return result;
+    }, grammarNode);
+};
+
+ParserCombinator lexeme(const ParserCombinator parserCombinator)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::LEXEME);
+    grammarNode.children = { parserCombinator };
+
+    return ParserCombinator([parserCombinator] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ParserCombinatorResult result;
+
+        {
+            SkipperScope skipperScope(nullptr);
+
+            result = parserCombinator(str, start);
+        }
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+
+        Token& token = std::get<Token>(result);
+
+        token.width += skipTrivia(str, start + token.width);
+
+        return result;
+    }, grammarNode);
+};
+
+ParserCombinator span(const std::string tokenId, const ParserCombinator parserCombinator)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::SPAN);
+    grammarNode.tokenId = tokenId;
+    grammarNode.children = { parserCombinator };
+
+    return ParserCombinator([tokenId, parserCombinator] (const std::string& str, const int start) -> ParserCombinatorResult {
+        RecognizerResult result;
+
+        {
+            SkipperScope skipperScope(nullptr);
+
+            result = parserCombinator.recognize(str, start);
+        }
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return std::get<ParserFailure>(result);
+
+        int width = std::get<int>(result);
+
+        return createToken(tokenId, str.substr(start, width), start, width + skipTrivia(str, start + width));
+    }, grammarNode);
+};
+
+ParserCombinator recoverable(const ParserCombinator item, const ParserCombinator sync)
+{
+    return recoverable("", item, sync);
+};
+
+// the failure recorded is the item's own, or sync's where the item stopped short of it, and the search for sync starts there
+
+ParserCombinator recoverable(const std::string tokenId, const ParserCombinator item, const ParserCombinator sync)
+{
+    GrammarNode grammarNode(GrammarNode::GrammarNodeType::RECOVERABLE);
+    grammarNode.tokenId = tokenId;
+    grammarNode.children = { item, sync };
+
+    return ParserCombinator([tokenId, item, sync] (const std::string& str, const int start) -> ParserCombinatorResult {
+        std::vector<ParserFailure>* recoveredFailures = parseState.recoveredFailures;
+
+        if (recoveredFailures == nullptr) return item(str, start);
+
+        ParserFailure farthestFailure(-1);
+
+        ParserCombinatorResult result;
+
+        {
+            FarthestFailureScope farthestFailureScope(&farthestFailure);
+
+            result = item(str, start);
+        }
+
+        if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+            int end = start + std::get<Token>(result).width;
+
+            reachInputEnd(str, end);
+
+            if (end == (int) str.size()) return result;
+
+            RecognizerResult syncResult = sync.recognize(str, end);
+
+            if (getResultType(syncResult) == ParserCombinatorResultType::TOKEN) return result;
+
+            discardToken(std::get<Token>(result));
+
+            result = std::get<ParserFailure>(syncResult);
+        }
+
+        ParserFailure& parserFailure = std::get<ParserFailure>(result);
+
+        int resume = std::max<int64_t>(start, std::min<int64_t>(parserFailure.start, str.size()));
+
+        while (resume < (int) str.size() && getResultType(sync.recognize(str, resume)) == ParserCombinatorResultType::PARSER_FAILURE) resume++;
+
+        reachInputEnd(str, resume);
+
+        // an item that stopped short, often on an empty alternative, failed for real further in, unless that was past the resync point
+
+        if (farthestFailure.start > parserFailure.start && farthestFailure.start <= resume) parserFailure = std::move(farthestFailure);
+
+        recoveredFailures->push_back(std::move(parserFailure));
+
+        return createToken(tokenId, str.substr(start, resume - start), start, resume - start);
+    }, grammarNode);
+};
+
+class GrammarCapture
+{
+    private:
+        std::set<std::string> capturedTokenIds;
+
+        std::map<const GrammarNode*, bool> producesCapturedTokens;
+        std::map<const GrammarNode*, ParserCombinator> capturedParserCombinators;
+        std::map<const ParserCombinator*, ParserCombinator*> capturedProxyTargets;
+
+        // children whose tokens can reach the result, the results of negate, noneOf, span and trivia are never kept
+
+        static std::vector<const GrammarNode*> tokenChildren(const GrammarNode* grammarNode)
+        {
+            std::vector<const GrammarNode*> children;
+
+            switch (grammarNode->type) {
+                case GrammarNode::GrammarNodeType::NEGATE:
+                case GrammarNode::GrammarNodeType::NONE_OF:
+                case GrammarNode::GrammarNodeType::SPAN:
+                case GrammarNode::GrammarNodeType::DISCARDED:
+                    break;
+                case GrammarNode::GrammarNodeType::SKIPPING:
+                    children.push_back(grammarNode->children[1].getGrammarNode());
+
+                    break;
+                case GrammarNode::GrammarNodeType::RECOVERABLE:
+                    children.push_back(grammarNode->children[0].getGrammarNode());
+
+                    break;
+                case GrammarNode::GrammarNodeType::PROXY:
+                    children.push_back(grammarNode->proxiedParserCombinator->getGrammarNode());
+
+                    break;
+                default:
+                    for (const ParserCombinator& child : grammarNode->children) children.push_back(child.getGrammarNode());
+            }
+
+            return children;
+        };
+
+        void analyze(const GrammarNode* root)
+        {
+            std::vector<const GrammarNode*> grammarNodes;
+            std::vector<const GrammarNode*> pending = { root };
+
+            while (!pending.empty()) {
+                const GrammarNode* grammarNode = pending.back();
+
+                pending.pop_back();
+
+                if (grammarNode == nullptr || this->producesCapturedTokens.count(grammarNode)) continue;
+
+                bool opaque = grammarNode->type == GrammarNode::GrammarNodeType::OPAQUE;
+
+                this->producesCapturedTokens[grammarNode] = opaque || this->capturedTokenIds.count(grammarNode->tokenId);
+
+                grammarNodes.push_back(grammarNode);
+
+                for (const GrammarNode* child : tokenChildren(grammarNode)) pending.push_back(child);
+            }
+
+            // recursion makes this a fixed point, a node produces kept tokens if any token child does
+
+            bool changed = true;
+
+            while (changed) {
+                changed = false;
+
+                for (const GrammarNode* grammarNode : grammarNodes) {
+                    if (this->producesCapturedTokens[grammarNode]) continue;
+
+                    for (const GrammarNode* child : tokenChildren(grammarNode)) {
+                        if (child == nullptr || this->producesCapturedTokens[child]) {
+                            this->producesCapturedTokens[grammarNode] = true;
+
+                            changed = true;
+
+                            break;
+                        }
+                    }
+                }
+            }
+        };
+
+        std::string capturedTokenId(const GrammarNode* grammarNode) const
+        {
+            return this->capturedTokenIds.count(grammarNode->tokenId) ? grammarNode->tokenId : "";
+        };
+
+        std::vector<ParserCombinator> captureChildren(const std::vector<ParserCombinator>& children)
+        {
+            std::vector<ParserCombinator> capturedChildren;
+
+            for (const ParserCombinator& child : children) capturedChildren.push_back(this->capture(child));
+
+            return capturedChildren;
+        };
+
+    public:
+        std::shared_ptr<std::deque<ParserCombinator>> ownedProxyTargets = std::make_shared<std::deque<ParserCombinator>>();
+
+        GrammarCapture(const std::vector<std::string>& capturedTokenIds, const GrammarNode* root)
+        {
+            this->capturedTokenIds.insert(capturedTokenIds.begin(), capturedTokenIds.end());
+
+            this->capturedTokenIds.erase("");
+
+            this->analyze(root);
+        };
+
+        ParserCombinator capture(const ParserCombinator& parserCombinator)
+        {
+            const GrammarNode* grammarNode = parserCombinator.getGrammarNode();
+
+            if (grammarNode == nullptr || grammarNode->type == GrammarNode::GrammarNodeType::OPAQUE) return parserCombinator;
+
+            if (!this->producesCapturedTokens[grammarNode]) return discarded(parserCombinator);
+
+            auto existing = this->capturedParserCombinators.find(grammarNode);
+
+            if (existing != this->capturedParserCombinators.end()) return existing->second;
+
+            ParserCombinator capturedParserCombinator = parserCombinator;
+
+            switch (grammarNode->type) {
+                case GrammarNode::GrammarNodeType::REPETITION:
+                    capturedParserCombinator = repetition(this->capturedTokenId(grammarNode), this->capture(grammarNode->children[0]), grammarNode->minCount, grammarNode->maxCount);
+
+                    break;
+                case GrammarNode::GrammarNodeType::STRICTLY_REPETITION:
+                    capturedParserCombinator = strictlyRepetition(this->capturedTokenId(grammarNode), this->capture(grammarNode->children[0]), grammarNode->minCount, grammarNode->maxCount);
+
+                    break;
+                case GrammarNode::GrammarNodeType::SEQUENCE:
+                    capturedParserCombinator = sequence(this->capturedTokenId(grammarNode), this->captureChildren(grammarNode->children));
+
+                    break;
+                case GrammarNode::GrammarNodeType::STRICTLY_SEQUENCE:
+                    capturedParserCombinator = strictlySequence(this->capturedTokenId(grammarNode), this->captureChildren(grammarNode->children));
+
+                    break;
+                case GrammarNode::GrammarNodeType::NEGATE:
+                    capturedParserCombinator = negate(grammarNode->tokenId, discarded(grammarNode->children[0]));
+
+                    break;
+                case GrammarNode::GrammarNodeType::CHOICE:
+                    capturedParserCombinator = choice(this->captureChildren(grammarNode->children));
+
+                    break;
+                case GrammarNode::GrammarNodeType::CHOICE_CONCURRENT:
+                    capturedParserCombinator = choiceConcurrent(this->captureChildren(grammarNode->children));
+
+                    break;
+                case GrammarNode::GrammarNodeType::ALL_OF:
+                    capturedParserCombinator = allOf(this->capturedTokenId(grammarNode), this->captureChildren(grammarNode->children));
+
+                    break;
+                case GrammarNode::GrammarNodeType::NAMED:
+                    capturedParserCombinator = this->capture(grammarNode->children[0]).named(grammarNode->name);
+
+                    break;
+                case GrammarNode::GrammarNodeType::SKIPPING:
+                    capturedParserCombinator = skipping(grammarNode->children[0], this->capture(grammarNode->children[1]));
+
+                    break;
+                case GrammarNode::GrammarNodeType::LEXEME:
+                    capturedParserCombinator = lexeme(this->capture(grammarNode->children[0]));
 
-            scanStart += token.width;
-        }
-        
-        if (scanStart != (int) str.size()) return nestedTokenGenerator(str, scanStart);
+                    break;
+                case GrammarNode::GrammarNodeType::RECOVERABLE:
+                    capturedParserCombinator = recoverable(this->capturedTokenId(grammarNode), this->capture(grammarNode->children[0]), grammarNode->children[1]);
 
-        else if (tokensFound < minCount) return ParserFailure(scanStart);
+                    break;
+                case GrammarNode::GrammarNodeType::PROXY: {
+                    // recursive rules get a rewritten copy owned by the result, so the rewritten proxies have something stable to point at
 
-        else return Token(tokenId, nestedTokens, start, scanStart - start);
-    });
+                    const ParserCombinator* proxiedParserCombinator = grammarNode->proxiedParserCombinator;
+
+                    auto existingTarget = this->capturedProxyTargets.find(proxiedParserCombinator);
+
+                    if (existingTarget == this->capturedProxyTargets.end()) {
+                        this->ownedProxyTargets->emplace_back();
+
+                        ParserCombinator* target = &this->ownedProxyTargets->back();
+
+                        existingTarget = this->capturedProxyTargets.insert({ proxiedParserCombinator, target }).first;
+
+                        *target = this->capture(*proxiedParserCombinator);
+                    }
+
+                    capturedParserCombinator = proxyParserCombinator(existingTarget->second);
+
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            this->capturedParserCombinators.insert({ grammarNode, capturedParserCombinator });
+
+            return capturedParserCombinator;
+        };
 };
 
-ParserCombinator optional(const ParserCombinator tokenGenerator)
+ParserCombinator capturing(const std::vector<std::string> capturedTokenIds, const ParserCombinator parserCombinator)
 {
-    return optional("", tokenGenerator);
+    const GrammarNode* grammarNode = parserCombinator.getGrammarNode();
+
+    if (grammarNode == nullptr) return parserCombinator;
+
+    GrammarCapture grammarCapture(capturedTokenIds, grammarNode);
+
+    ParserCombinator capturedParserCombinator = grammarCapture.capture(parserCombinator);
+
+    std::shared_ptr<std::deque<ParserCombinator>> ownedProxyTargets = grammarCapture.ownedProxyTargets;
+
+    if (ownedProxyTargets->empty()) return capturedParserCombinator;
+
+    return ParserCombinator([capturedParserCombinator, ownedProxyTargets] (const std::string& str, const int start) -> ParserCombinatorResult {
+        return capturedParserCombinator(str, start);
+    }, *capturedParserCombinator.getGrammarNode());
 };
 
-ParserCombinator optional(const std::string tokenId, const ParserCombinator tokenGenerator)
+// rewriting per document would dominate small inputs, so the grammars rewritten most recently are kept for every thread,
+// holding on to the original keeps its grammar node from being freed and its address reused by another grammar
+
+struct CapturedGrammar
 {
-    return repetition(tokenId, tokenGenerator, 0, 1);
+    ParserCombinator original;
+    std::vector<std::string> capturedTokenIds;
+    ParserCombinator captured;
 };
 
-ParserCombinator sequence(const std::vector<ParserCombinator> tokenGeneratorSequence)
+const int capturedGrammarCacheSize = 16;
+
+std::mutex capturedGrammarsMutex;
+std::deque<CapturedGrammar> capturedGrammars;
+
+ParserCombinator cachedCapturing(const std::vector<std::string>& capturedTokenIds, const ParserCombinator& parserCombinator)
 {
-    return sequence("", tokenGeneratorSequence);
+    {
+        std::lock_guard<std::mutex> lock(capturedGrammarsMutex);
+
+        for (auto capturedGrammar = capturedGrammars.begin();capturedGrammar != capturedGrammars.end();capturedGrammar++) {
+            if (capturedGrammar->original.getGrammarNode() != parserCombinator.getGrammarNode() || capturedGrammar->capturedTokenIds != capturedTokenIds) continue;
+
+            if (capturedGrammar != capturedGrammars.begin()) {
+                CapturedGrammar recentlyUsed = std::move(*capturedGrammar);
+
+                capturedGrammars.erase(capturedGrammar);
+
+                capturedGrammars.push_front(std::move(recentlyUsed));
+            }
+
+            return capturedGrammars.front().captured;
+        }
+    }
+
+    // threads missing at once may both rewrite, the later one just moves to the front
+
+    ParserCombinator captured = capturing(capturedTokenIds, parserCombinator);
+
+    std::lock_guard<std::mutex> lock(capturedGrammarsMutex);
+
+    capturedGrammars.push_front({ parserCombinator, capturedTokenIds, captured });
+
+    if ((int) capturedGrammars.size() > capturedGrammarCacheSize) capturedGrammars.pop_back();
+
+    return captured;
 };
 
-ParserCombinator sequence(const std::string tokenId, const std::vector<ParserCombinator> tokenGeneratorSequence)
+void clearCapturedGrammars()
 {
-    return ParserCombinator([tokenId, tokenGeneratorSequence] (const std::string& str, const int start) -> ParserCombinatorResult {
-        std::vector<Token> sequenceTokens;
+    std::deque<CapturedGrammar> released;
 
-        int scanOffset = 0;
+    {
+        std::lock_guard<std::mutex> lock(capturedGrammarsMutex);
+
+        released.swap(capturedGrammars);
+    }
+};
 
-        for (ParserCombinator tokenGenerator : tokenGeneratorSequence) {
-            ParserCombinatorResult result = tokenGenerator(str, start + scanOffset);
+ParserCombinatorResult parse(const std::string& str, const ParserCombinator parserCombinator)
+{
+    return parserCombinator(str, 0);
+};
 
-            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+RecoveredParse parseWithRecovery(const std::string& str, const ParserCombinator parserCombinator)
+{
+    return parseWithRecovery(str, parserCombinator, ParseOptions());
+};
 
-            Token token = getTokenFromResult(result);
+RecoveredParse parseWithRecovery(const std::string& str, const ParserCombinator parserCombinator, const ParseOptions& options)
+{
+    RecoveredParse recoveredParse;
 
-            addChildToken(sequenceTokens, token);
+    {
+        RecoveredFailuresScope recoveredFailuresScope(&recoveredParse.failures);
 
-            scanOffset += token.width;
-        }
+        recoveredParse.result = parse(str, parserCombinator, options);
+    }
 
-        return Token(tokenId, sequenceTokens, start, scanOffset);
-    });
+    // a failing root has already taken back everything recorded inside it
+
+    if (getResultType(recoveredParse.result) == ParserCombinatorResultType::PARSER_FAILURE) recoveredParse.failures.push_back(getParserFailureFromResult(recoveredParse.result));
+
+    return recoveredParse;
 };
 
-ParserCombinator strictlySequence(const std::vector<ParserCombinator> tokenGeneratorSequence) {
-    return ParserCombinator([tokenGeneratorSequence] (const std::string& str, const int start) -> ParserCombinatorResult {
-        ParserCombinatorResult result = sequence(tokenGeneratorSequence)(str, start);
+ParserCombinatorResult parseWithinBudget(const std::string& str, const int start, const ParserCombinator grammar, const ParseOptions& options)
+{
+    bool budgeted = options.maxSteps > 0 || options.deadline != std::chrono::steady_clock::time_point::max() || options.cancellation != nullptr;
 
-        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+    if (!budgeted) return grammar(str, start);
 
-        Token token = getTokenFromResult(result);
+    ParseBudget budget(options);
 
-        if (token.start + token.width == (int) str.size()) return token;
+    ParserCombinatorResult result;
 
-        else return ParserFailure(token.start + token.width, "end of input");
-    });
+    {
+        ParseBudgetScope parseBudgetScope(&budget);
+
+        result = grammar(str, start);
+    }
+
+    // once the budget runs out every combinator fails, so whatever came back is meaningless
+
+    if (budget.exhaustion != ParserFailure::ParserFailureType::MISMATCH) {
+        discardResult(result);
+
+        return ParserFailure(budget.farthestPosition, (ParserFailure::ParserFailureType) budget.exhaustion.load());
+    }
+
+    return result;
 };
 
-ParserCombinator strictlySequence(const std::string tokenId, const std::vector<ParserCombinator> tokenGeneratorSequence) {
-    return ParserCombinator([tokenId, tokenGeneratorSequence] (const std::string& str, const int start) -> ParserCombinatorResult {
-        ParserCombinatorResult result = sequence(tokenId, tokenGeneratorSequence)(str, start);
+thread_local ParseTelemetry threadTelemetry;
 
-        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
+ParserCombinatorResult parseFrom(const std::string& str, const int start, const ParserCombinator parserCombinator, const ParseOptions& options)
+{
+    SplicingScope splicingScope(options.splicing);
 
-        Token token = getTokenFromResult(result);
+    ParserCombinator grammar = options.capturedTokenIds.empty() ? parserCombinator : cachedCapturing(options.capturedTokenIds, parserCombinator);
 
-        if (token.start + token.width == (int) str.size()) return token;
+    PrecomputedResultsScope precomputedResultsScope(options.precomputedResults);
 
-        else return ParserFailure(token.start + token.width, "end of input");
-    });
+    if (options.telemetry == nullptr) return parseWithinBudget(str, start, grammar, options);
+
+    TelemetryCounters telemetryCounters;
+
+    ParseTelemetryScope parseTelemetryScope(&telemetryCounters);
+
+    ParserCombinatorResult result = parseWithinBudget(str, start, grammar, options);
+
+    ParseTelemetry& telemetry = *options.telemetry;
+
+    telemetry.nodesCreated = telemetryCounters.nodesCreated;
+    telemetry.nodesDiscarded = telemetryCounters.nodesDiscarded;
+    telemetry.bytesAllocated = telemetryCounters.bytesAllocated;
+    telemetry.peakLiveBytes = telemetryCounters.peakLiveBytes;
+    telemetry.maxDepth = telemetryCounters.maxDepth;
+    telemetry.parses = 1;
+
+    threadTelemetry.nodesCreated += telemetry.nodesCreated;
+    threadTelemetry.nodesDiscarded += telemetry.nodesDiscarded;
+    threadTelemetry.bytesAllocated += telemetry.bytesAllocated;
+    threadTelemetry.peakLiveBytes = std::max(threadTelemetry.peakLiveBytes, telemetry.peakLiveBytes);
+    threadTelemetry.maxDepth = std::max(threadTelemetry.maxDepth, telemetry.maxDepth);
+    threadTelemetry.parses++;
+
+    return result;
 };
 
-ParserCombinator string(const std::string stringLiteral)
+ParserCombinatorResult parse(const std::string& str, const ParserCombinator parserCombinator, const ParseOptions& options)
 {
-    return string("", stringLiteral);
+    return parseFrom(str, 0, parserCombinator, options);
 };
 
-ParserCombinator string(const std::string tokenId, const std::string stringLiteral)
+ParseTelemetry threadParseTelemetry()
 {
-    return ParserCombinator([tokenId, stringLiteral] (const std::string& str, const int start) -> ParserCombinatorResult {
-        if (stringLiteral != str.substr(start, stringLiteral.size())) return ParserFailure(start);
-        
-        else return Token(tokenId, stringLiteral, start, stringLiteral.size());
-    });
+    return threadTelemetry;
 };
 
-ParserCombinator negate(const ParserCombinator tokenGenerator)
+void resetThreadParseTelemetry()
 {
-    return negate("", tokenGenerator);
+    threadTelemetry = ParseTelemetry();
 };
 
-ParserCombinator negate(const std::string tokenId, const ParserCombinator tokenGenerator)
+RecognizerResult recognize(const std::string& str, const ParserCombinator parserCombinator)
 {
-    return ParserCombinator([tokenId, tokenGenerator] (const std::string& str, const int start) -> ParserCombinatorResult {
-        ParserCombinatorResult result = tokenGenerator(str, start);
+    return parserCombinator.recognize(str, 0);
+};
 
-        if (getResultType(result) == ParserCombinatorResultType::TOKEN) return ParserFailure(start);
+void offsetToken(Token& token, const int64_t offset)
+{
+    token.start += offset;
 
-        else return Token(tokenId, std::vector<Token>(), start, 0);
-    });
+    if (token.type == Token::TokenType::NEST) for (Token& child : std::get<std::vector<Token>>(token.content)) offsetToken(child, offset);
 };
 
-ParserCombinator choice(const std::vector<ParserCombinator> tokenGeneratorChoices)
+StreamParser::StreamParser(const ParserCombinator item)
 {
-    return ParserCombinator([tokenGeneratorChoices] (const std::string& str, const int start) -> ParserCombinatorResult {
-        if (tokenGeneratorChoices.empty()) return ParserFailure(start);
+    this->item = item;
+};
 
-        bool foundToken = false;
-        std::vector<ParserFailure> parseFailures;
-        Token bestToken;
+StreamParser::StreamParser(const ParserCombinator item, const ParserCombinator opening, const ParserCombinator closing, const int maxDepth)
+{
+    this->item = item;
+    this->opening = opening;
+    this->closing = closing;
+    this->maxDepth = maxDepth;
+};
 
-        for (const ParserCombinator& tokenGenerator : tokenGeneratorChoices) {
-            ParserCombinatorResult result = tokenGenerator(str, start);
+ParserCombinatorResult StreamParser::parseAt(const ParserCombinator& parserCombinator, const int start, bool& inputEndReached)
+{
+    bool previousInputEndReached = parseState.inputEndReached;
 
-            if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
-                Token token = getTokenFromResult(result);
+    parseState.inputEndReached = false;
 
-                if (!foundToken || token.width > bestToken.width) {
-                    foundToken = true;
+    ParserCombinatorResult result = parserCombinator(this->buffer, start);
 
-                    bestToken = token;
-                }
-            }
-            else if (!foundToken) {
-                ParserFailure parseFailure = getParserFailureFromResult(result);
+    inputEndReached = parseState.inputEndReached;
 
-                if (parseFailures.empty() || parseFailure.start > parseFailures[0].start) parseFailures = { parseFailure };
+    parseState.inputEndReached = previousInputEndReached;
 
-                else if (parseFailure.start == parseFailures[0].start) parseFailures.push_back(parseFailure);
-            }
+    // combinators made from plain functions never mark the input end, so anything that stops right at it might still change
+
+    int end = getResultType(result) == ParserCombinatorResultType::TOKEN ? getTokenFromResult(result).start + getTokenFromResult(result).width : getParserFailureFromResult(result).start;
+
+    if (end >= (int) this->buffer.size()) inputEndReached = true;
+
+    return result;
+};
+
+// anything whose parse looked at the end of the buffer could still come out differently, so it waits for more input and is parsed again;
+// inside an opening the closing is tried before an item, outside one below maxDepth the opening is
+
+std::vector<Token> StreamParser::parseItems(const bool final)
+{
+    std::vector<Token> items;
+
+    int scanStart = 0;
+
+    while (!this->failed && scanStart < (int) this->buffer.size()) {
+        // everything before the pending item has been handed out, only parsing that item again waits for its input to double
+
+        if (!final && scanStart == this->pendingStart && (int) this->buffer.size() - scanStart < 2 * this->pendingSize) break;
+
+        bool inputEndReached = false;
+
+        ParserCombinatorResult result = ParserFailure(scanStart);
+
+        int depthChange = 0;
+
+        if (this->depth > 0) {
+            result = this->parseAt(this->closing, scanStart, inputEndReached);
+
+            depthChange = -1;
+        } else if (this->depth < this->maxDepth) {
+            result = this->parseAt(this->opening, scanStart, inputEndReached);
+
+            depthChange = 1;
         }
 
-        if (foundToken) return bestToken;
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE && (!inputEndReached || final)) {
+            ParserFailure unitFailure = getParserFailureFromResult(std::move(result));
 
-        else return ParserFailure::composeFrom(parseFailures);
-    });
+            result = this->parseAt(this->item, scanStart, inputEndReached);
+
+            depthChange = 0;
+
+            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE && unitFailure.start > getParserFailureFromResult(result).start) result = unitFailure;
+        }
+
+        if (inputEndReached && !final) {
+            this->pendingStart = scanStart;
+            this->pendingSize = this->buffer.size() - scanStart;
+
+            break;
+        }
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE || std::get<Token>(result).width == 0) {
+            this->failed = true;
+            this->failure = getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE ? getParserFailureFromResult(std::move(result)) : ParserFailure(scanStart);
+            this->failure.start += this->bufferOffset;
+
+            break;
+        }
+
+        Token token = getTokenFromResult(std::move(result));
+
+        scanStart += token.width;
+
+        this->depth += depthChange;
+        this->pendingStart = -1;
+        this->pendingSize = 0;
+
+        offsetToken(token, this->bufferOffset);
+
+        items.push_back(std::move(token));
+    }
+
+    // the stream ended inside an opening, so the closing is missing
+
+    if (final && !this->failed && this->depth > 0) {
+        bool inputEndReached = false;
+
+        ParserCombinatorResult result = this->parseAt(this->closing, scanStart, inputEndReached);
+
+        this->failed = true;
+        this->failure = getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE ? getParserFailureFromResult(std::move(result)) : ParserFailure(scanStart);
+        this->failure.start += this->bufferOffset;
+    }
+
+    this->buffer.erase(0, scanStart);
+    this->bufferOffset += scanStart;
+
+    if (this->pendingStart != -1) this->pendingStart -= scanStart;
+
+    return items;
 };
 
-ParserCombinator choiceConcurrent(const std::vector<ParserCombinator> tokenGeneratorChoices)
+std::vector<Token> StreamParser::feed(const std::string& chunk)
 {
-    return ParserCombinator([tokenGeneratorChoices] (const std::string& str, const int start) -> ParserCombinatorResult {
-        if (tokenGeneratorChoices.empty()) return ParserFailure(start);
-        
-        std::vector<std::future<ParserCombinatorResult>> tokenGeneratorThreads;
+    if (this->failed) return std::vector<Token>();
 
-        for (const ParserCombinator& tokenGenerator : tokenGeneratorChoices) tokenGeneratorThreads.push_back(std::async(std::launch::async, tokenGenerator, str, start));
+    this->buffer += chunk;
 
-        std::vector<ParserCombinatorResult> tokenGeneratorResults;
+    return this->parseItems(false);
+};
 
-        bool foundToken = false;
-        std::vector<ParserFailure> parseFailures;
-        Token bestToken;
+std::vector<Token> StreamParser::finish()
+{
+    std::vector<Token> items = this->parseItems(true);
 
-        for (auto& thread : tokenGeneratorThreads) {
-            ParserCombinatorResult result = thread.get();
+    this->buffer.clear();
+    this->buffer.shrink_to_fit();
 
-            if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
-                Token token = getTokenFromResult(result);
+    return items;
+};
 
-                if (!foundToken || token.width > bestToken.width) {
-                    foundToken = true;
+bool StreamParser::hasFailed() const
+{
+    return this->failed;
+};
+
+ParserFailure StreamParser::getFailure() const
+{
+    return this->failure;
+};
 
-                    bestToken = token;
+// long lived workers so per thread scratch survives between batches, the calling thread also claims work
+
+class ParserThreadPool
+{
+    private:
+        std::vector<std::thread> workers;
+
+        std::mutex jobMutex;
+        std::mutex stateMutex;
+        std::condition_variable jobAvailable;
+        std::condition_variable jobFinished;
+
+        const std::function<void(int)>* job = nullptr;
+        int jobSize = 0;
+        std::atomic<int> nextJobIndex;
+        int busyWorkers = 0;
+        unsigned long generation = 0;
+        bool stopping = false;
+
+        // the first exception a task of the running job threw, rethrown by run once every worker is done
+        std::exception_ptr failure;
+
+        static thread_local bool isWorker;
+
+        // the caller claims jobs as a pool member too, so a batch nested in one of its tasks runs inline instead of waiting on the pool
+
+        void claimJobs(const std::function<void(int)>& task, const int taskCount)
+        {
+            bool wasWorker = isWorker;
+
+            isWorker = true;
+
+            for (int i = this->nextJobIndex++;i<taskCount;i = this->nextJobIndex++) {
+                try {
+                    task(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(this->stateMutex);
+
+                    if (!this->failure) this->failure = std::current_exception();
+
+                    // the jobs nobody has claimed yet are dropped
+
+                    this->nextJobIndex = taskCount;
                 }
             }
-            else if (!foundToken) {
-                ParserFailure parseFailure = getParserFailureFromResult(result);
 
-                if (parseFailures.empty() || parseFailure.start > parseFailures[0].start) parseFailures = { parseFailure };
+            isWorker = wasWorker;
+        };
+
+        void work()
+        {
+            isWorker = true;
+
+            unsigned long seenGeneration = 0;
 
-                else if (parseFailure.start == parseFailures[0].start) parseFailures.push_back(parseFailure);
+            while (true) {
+                const std::function<void(int)>* task;
+                int taskCount;
+
+                {
+                    std::unique_lock<std::mutex> lock(this->stateMutex);
+
+                    this->jobAvailable.wait(lock, [&] { return this->stopping || this->generation != seenGeneration; });
+
+                    if (this->stopping) return;
+
+                    seenGeneration = this->generation;
+                    task = this->job;
+                    taskCount = this->jobSize;
+                }
+
+                this->claimJobs(*task, taskCount);
+
+                std::lock_guard<std::mutex> lock(this->stateMutex);
+
+                if (--this->busyWorkers == 0) this->jobFinished.notify_one();
             }
-        }
+        };
 
-        if (foundToken) return bestToken;
+    public:
+        ParserThreadPool()
+        {
+            int workerCount = (int) std::thread::hardware_concurrency() - 1;
 
-        else return ParserFailure::composeFrom(parseFailures);
-    });
+            for (int i = 0;i<workerCount;i++) this->workers.emplace_back([this] { this->work(); });
+        };
+
+        ~ParserThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->stateMutex);
+
+                this->stopping = true;
+            }
+
+            this->jobAvailable.notify_all();
+
+            for (std::thread& worker : this->workers) worker.join();
+        };
+
+        void run(const int taskCount, const std::function<void(int)>& task)
+        {
+            if (isWorker || this->workers.empty() || taskCount < 2) {
+                for (int i = 0;i<taskCount;i++) task(i);
+
+                return;
+            }
+
+            std::lock_guard<std::mutex> jobLock(this->jobMutex);
+
+            {
+                std::lock_guard<std::mutex> lock(this->stateMutex);
+
+                this->job = &task;
+                this->jobSize = taskCount;
+                this->nextJobIndex = 0;
+                this->busyWorkers = this->workers.size();
+                this->failure = nullptr;
+                this->generation++;
+            }
+
+            this->jobAvailable.notify_all();
+
+            this->claimJobs(task, taskCount);
+
+            std::unique_lock<std::mutex> lock(this->stateMutex);
+
+            this->jobFinished.wait(lock, [this] { return this->busyWorkers == 0; });
+
+            std::exception_ptr failure = this->failure;
+
+            this->failure = nullptr;
+
+            lock.unlock();
+
+            if (failure) std::rethrow_exception(failure);
+        };
+
+        static ParserThreadPool& shared()
+        {
+            static ParserThreadPool pool;
+
+            return pool;
+        };
 };
 
-ParserCombinator allOf(const std::string tokenId, const std::vector<ParserCombinator> tokenGeneratorRequirements)
+thread_local bool ParserThreadPool::isWorker = false;
+
+std::vector<ParserCombinatorResult> parseBatch(const std::vector<std::string>& strs, const ParserCombinator parserCombinator)
 {
-    return ParserCombinator([tokenId, tokenGeneratorRequirements] (const std::string& str, const int start) -> ParserCombinatorResult {
-        std::vector<Token> tokens;
-        int largestTokenWidth = 0;
+    return parseBatch(strs, parserCombinator, ParseOptions());
+};
 
-        for (const ParserCombinator& tokenGeneratorRequirement : tokenGeneratorRequirements) {
-            ParserCombinatorResult result = tokenGeneratorRequirement(str, start);
+// each worker fills its own telemetry, the batch reports them folded together like the thread totals
 
-            if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return result;
-            
-            Token token = getTokenFromResult(result);
+std::vector<ParserCombinatorResult> parseTasks(const int taskCount, const ParseOptions& options, const std::function<ParserCombinatorResult(int, const ParseOptions&)>& task)
+{
+    std::vector<ParserCombinatorResult> results(taskCount);
 
-            addChildToken(tokens, token);
+    std::vector<ParseTelemetry> telemetries(options.telemetry == nullptr ? 0 : taskCount);
 
-            if (token.width > largestTokenWidth) largestTokenWidth = token.width;
+    ParserThreadPool::shared().run(taskCount, [&options, &task, &results, &telemetries] (int i) {
+        if (telemetries.empty()) {
+            results[i] = task(i, options);
+
+            return;
         }
 
-        return Token(tokenId, tokens, start, largestTokenWidth);
+        ParseOptions workerOptions = options;
+
+        workerOptions.telemetry = &telemetries[i];
+
+        results[i] = task(i, workerOptions);
     });
-};
 
-ParserCombinator noneOf(const std::vector<ParserCombinator> tokenGeneratorRequirements)
-{
-    return ParserCombinator([tokenGeneratorRequirements] (const std::string& str, const int start) -> ParserCombinatorResult {
-        for (const ParserCombinator& tokenGeneratorRequirement : tokenGeneratorRequirements) {
-            ParserCombinatorResult result = tokenGeneratorRequirement(str, start);
+    if (options.telemetry != nullptr) {
+        ParseTelemetry& telemetry = *options.telemetry;
+
+        telemetry = ParseTelemetry();
 
-            if (getResultType(result) == ParserCombinatorResultType::TOKEN) return ParserFailure(start);
+        for (const ParseTelemetry& workerTelemetry : telemetries) {
+            telemetry.nodesCreated += workerTelemetry.nodesCreated;
+            telemetry.nodesDiscarded += workerTelemetry.nodesDiscarded;
+            telemetry.bytesAllocated += workerTelemetry.bytesAllocated;
+            telemetry.peakLiveBytes = std::max(telemetry.peakLiveBytes, workerTelemetry.peakLiveBytes);
+            telemetry.maxDepth = std::max(telemetry.maxDepth, workerTelemetry.maxDepth);
+            telemetry.parses += workerTelemetry.parses;
         }
+    }
 
-        return Token("", std::vector<Token>(), start, 0);
-    });
+    return results;
 };
 
-ParserCombinator proxyParserCombinator(const ParserCombinator* parserCombinatorPointer)
+std::vector<ParserCombinatorResult> parseBatch(const std::vector<std::string>& strs, const ParserCombinator parserCombinator, const ParseOptions& options)
 {
-    return ParserCombinator([parserCombinatorPointer] (const std::string& str, const int start) -> ParserCombinatorResult {
-        ParserCombinator proxiedParserCombinator = *parserCombinatorPointer;
-
-        return proxiedParserCombinator(str, start);
+    return parseTasks(strs.size(), options, [&strs, &parserCombinator] (int i, const ParseOptions& workerOptions) {
+        return parse(strs[i], parserCombinator, workerOptions);
     });
 };
 
-ParserCombinatorResult parse(const std::string& str, const ParserCombinator parserCombinator)
+std::vector<ParserCombinatorResult> parseBatch(const std::string& str, const ParserCombinator parserCombinator, const std::vector<int>& starts)
 {
-    return parserCombinator(str, 0);
-};
\ No newline at end of file
+    return parseBatch(str, parserCombinator, starts, ParseOptions());
+};
+
+std::vector<ParserCombinatorResult> parseBatch(const std::string& str, const ParserCombinator parserCombinator, const std::vector<int>& starts, const ParseOptions& options)
+{
+    return parseTasks(starts.size(), options, [&str, &parserCombinator, &starts] (int i, const ParseOptions& workerOptions) {
+        return parseFrom(str, starts[i], parserCombinator, workerOptions);
+    });
+};
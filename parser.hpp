@@ -1,12 +1,33 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <variant>
 #include <functional>
+#include <memory>
+#include <bitset>
+#include <chrono>
+#include <atomic>
+#include <map>
 
 typedef std::function<bool(const char&)> Predicate;
+typedef std::function<bool(const char32_t&)> CodePointPredicate;
+
+// tabulated predicate, predicates built only from is / negate / anyOf / noneOf stay inspectable as one of these
+
+class CharacterClass
+{
+    public:
+        std::bitset<256> members;
+
+        CharacterClass() = default;
+
+        CharacterClass(std::bitset<256> members);
+
+        bool operator()(const char& c) const;
+};
 
 Predicate is(const char& c);
 Predicate negate(const Predicate predicate);
@@ -28,13 +49,15 @@ class Token
 
         std::variant<std::string, std::vector<Token>> content;
 
-        int start;
-        int width;
+        // combinators parse at int offsets, a tree put together from pieces of a longer input still places them in it
+
+        int64_t start;
+        int64_t width;
 
         Token() = default;
     
-        Token(std::string id, std::string stringLiteral, int start, int width);
-        Token(std::string id, std::vector<Token> nesting, int start, int width);
+        Token(std::string id, std::string stringLiteral, int64_t start, int64_t width);
+        Token(std::string id, std::vector<Token> nesting, int64_t start, int64_t width);
 
         const std::string& getStringLiteralContent() const;
         const std::vector<Token>& getNestingContent() const;
@@ -46,12 +69,24 @@ class Token
 class ParserFailure
 {
     public:
-        int start;
+        int64_t start;
 
         std::string name;
 
-        ParserFailure(int start);
-        ParserFailure(int start, std::string name);
+        // anything but a mismatch means a parse budget ran out, start is then the farthest position the parse reached
+
+        enum ParserFailureType {
+            MISMATCH,
+            STEP_LIMIT,
+            DEADLINE,
+            CANCELLED
+        } type = MISMATCH;
+
+        // explicit so a width never quietly turns into a failure inside a RecognizerResult
+
+        explicit ParserFailure(int64_t start);
+        ParserFailure(int64_t start, std::string name);
+        ParserFailure(int64_t start, ParserFailureType type);
 
         static ParserFailure composeFrom(std::vector<ParserFailure> parserFailures);
 
@@ -66,22 +101,56 @@ enum ParserCombinatorResultType
 
 typedef std::variant<Token, ParserFailure> ParserCombinatorResult;
 
-ParserCombinatorResultType getResultType(ParserCombinatorResult result);
-Token getTokenFromResult(ParserCombinatorResult result);
-ParserFailure getParserFailureFromResult(ParserCombinatorResult result);
+// the rvalue overloads move out of a result that is no longer needed instead of copying the whole tree
+
+ParserCombinatorResultType getResultType(const ParserCombinatorResult& result);
+const Token& getTokenFromResult(const ParserCombinatorResult& result);
+Token getTokenFromResult(ParserCombinatorResult&& result);
+const ParserFailure& getParserFailureFromResult(const ParserCombinatorResult& result);
+ParserFailure getParserFailureFromResult(ParserCombinatorResult&& result);
+
+// what a parse would have matched, as the width of the match, without building any tokens
+
+typedef std::variant<int, ParserFailure> RecognizerResult;
+
+ParserCombinatorResultType getResultType(const RecognizerResult& result);
+int getWidthFromResult(const RecognizerResult& result);
+const ParserFailure& getParserFailureFromResult(const RecognizerResult& result);
+
+class GrammarNode;
+class DFA;
+class Skipper;
+class CodePointClass;
+
+// appends what a combinator matched to the caller's children the way a parent would splice its result, returning the width
+
+typedef std::function<RecognizerResult(const std::string&, const int, std::vector<Token>&)> TokenSplicer;
 
 class ParserCombinator
 {
     private:
-        std::function<ParserCombinatorResult(const std::string&, const int)> implementation;
+        // shared so copying a combinator, as every builder does with its children, never copies the captured graph
+
+        std::shared_ptr<const std::function<ParserCombinatorResult(const std::string&, const int)>> implementation;
+        std::shared_ptr<const TokenSplicer> splicer;
+
+        std::shared_ptr<const GrammarNode> grammarNode;
 
     public:
         ParserCombinator() = default;
 
         ParserCombinator(std::function<ParserCombinatorResult(const std::string&, const int)> implementation);
+        ParserCombinator(std::function<ParserCombinatorResult(const std::string&, const int)> implementation, GrammarNode grammarNode);
+        ParserCombinator(std::function<ParserCombinatorResult(const std::string&, const int)> implementation, TokenSplicer splicer, GrammarNode grammarNode);
 
         ParserCombinatorResult operator()(const std::string&, const int) const;
 
+        RecognizerResult parseInto(const std::string&, const int, std::vector<Token>& tokens) const;
+
+        RecognizerResult recognize(const std::string&, const int) const;
+
+        const GrammarNode* getGrammarNode() const;
+
         ParserCombinator repeatedly() const;
         ParserCombinator repeatedly(const int minCount) const;
         ParserCombinator repeatedly(const int minCount, const int maxCount) const;
@@ -109,11 +178,76 @@ class ParserCombinator
         ParserCombinator surroundedBy(const std::string wrapperTokenId, const ParserCombinator neighbor) const;
 
         ParserCombinator named(const std::string name) const;
+
+        ParserCombinator asSpan(const std::string tokenId) const;
+};
+
+// what a builder was called with, combinators made from raw lambdas are OPAQUE
+
+class GrammarNode
+{
+    private:
+        std::string toString(int indent) const;
+
+    public:
+        enum GrammarNodeType {
+            OPAQUE,
+            SATISFY,
+            STRING,
+            LITERAL,
+            REGEX,
+            REPETITION,
+            STRICTLY_REPETITION,
+            SEQUENCE,
+            STRICTLY_SEQUENCE,
+            NEGATE,
+            CHOICE,
+            CHOICE_CONCURRENT,
+            ALL_OF,
+            NONE_OF,
+            NAMED,
+            PROXY,
+            SKIPPING,
+            LEXEME,
+            SPAN,
+            DISCARDED,
+            RECOVERABLE,
+            CODE_POINT
+        } type;
+
+        std::string tokenId;
+        std::string name;
+
+        Predicate predicate;
+
+        std::string stringLiteral;
+        std::vector<int> segmentStarts;
+
+        std::shared_ptr<const DFA> dfa;
+        std::shared_ptr<const Skipper> skipper;
+        std::shared_ptr<const CodePointClass> codePointClass;
+
+        int minCount = 0;
+        int maxCount = 0;
+
+        std::vector<ParserCombinator> children;
+
+        const ParserCombinator* proxiedParserCombinator = nullptr;
+
+        GrammarNode(GrammarNodeType type);
+
+        std::string toString() const;
 };
 
 ParserCombinator satisfy(const Predicate predicate);
 ParserCombinator satisfy(const std::string tokenId, const Predicate predicate);
 
+// one UTF-8 encoded code point, its token holds the bytes and start / width stay byte offsets, malformed sequences never match
+// an anonymous one repeated skips over its ASCII members without decoding them, see unicode.hpp for category predicates
+
+ParserCombinator satisfyCodePoint(const CodePointPredicate predicate);
+ParserCombinator satisfyCodePoint(const std::string tokenId, const CodePointPredicate predicate);
+
 ParserCombinator repetition(const ParserCombinator nestedTokenGenerator);
 ParserCombinator repetition(const ParserCombinator nestedTokenGenerator, const int minCount);
 ParserCombinator repetition(const ParserCombinator nestedTokenGenerator, const int minCount, const int maxCount);
@@ -140,6 +274,9 @@ ParserCombinator strictlySequence(const std::string tokenId, const std::vector<P
 ParserCombinator string(const std::string strLiteral);
 ParserCombinator string(const std::string tokenId, const std::string strLiteral);
 
+ParserCombinator regex(const std::string pattern);
+ParserCombinator regex(const std::string tokenId, const std::string pattern);
+
 ParserCombinator negate(const ParserCombinator tokenGenerator);
 ParserCombinator negate(const std::string tokenId, const ParserCombinator tokenGenerator);
 
@@ -151,6 +288,172 @@ ParserCombinator noneOf(const std::vector<ParserCombinator> tokenGeneratorRequir
 
 ParserCombinator proxyParserCombinator(const ParserCombinator* parserCombinatorPointer);
 
+// inside skipping, every leaf also consumes the trivia that follows it and widens its token to cover it, no trivia tokens are built
+// a trivia of repeated satisfy over a character class is skipped with a plain table scan
+// lexeme turns the skipper off inside its child, so the child only skips trivia after its last char
+
+ParserCombinator skipping(const ParserCombinator trivia, const ParserCombinator parserCombinator);
+ParserCombinator lexeme(const ParserCombinator parserCombinator);
+
+// matches like lexeme but keeps no nested tokens, only one literal of the matched text
+
+ParserCombinator span(const std::string tokenId, const ParserCombinator parserCombinator);
+
+// rewrites a grammar so only tokens with the given ids are built, the children of every other token move up into the nearest kept one
+// and subtrees that cannot contain a kept token are only recognized
+// the result shares its unchanged subtrees with the original graph, and its rewritten recursive rules are owned by the returned combinator,
+// so combinators taken out of its grammar node must not outlive it
+
+ParserCombinator capturing(const std::vector<std::string> capturedTokenIds, const ParserCombinator parserCombinator);
+
+// parses with captured token ids keep the rewrites of the grammars they used last, this drops them
+
+void clearCapturedGrammars();
+
+// in a parse with recovery, an item that fails or is not followed by sync records the failure and becomes a literal token of
+// everything up to the next sync, elsewhere it is just the item
+
+ParserCombinator recoverable(const ParserCombinator item, const ParserCombinator sync);
+ParserCombinator recoverable(const std::string tokenId, const ParserCombinator item, const ParserCombinator sync);
+
+// what one combinator returns at each start, handed out whenever the parse calls the combinator there
+
+class PrecomputedResults
+{
+    public:
+        ParserCombinator parserCombinator;
+
+        std::map<int, ParserCombinatorResult> results;
+};
+
+// what one parse allocated for its tokens, the heap memory behind their ids, string literals and child vectors,
+// where strings short enough to be stored inline allocate nothing
+
+class ParseTelemetry
+{
+    public:
+        // tokens the combinators built, neither copies nor tokens from combinators made of plain functions count
+        long long nodesCreated = 0;
+
+        // counted where a created token is dropped, by a failed alternative, a rolled back branch or an anonymous token unwrapped into its parent
+        long long nodesDiscarded = 0;
+
+        long long bytesAllocated = 0;
+        long long peakLiveBytes = 0;
+
+        // combinator calls nested at once
+        int maxDepth = 0;
+
+        long long parses = 0;
+};
+
+class ParseOptions
+{
+    public:
+        // every token is kept when empty, use recognize when none are wanted,
+        // the rewritten grammar is cached by its root, so after reassigning a rule a proxy points to call clearCapturedGrammars
+
+        std::vector<std::string> capturedTokenIds;
+
+        // children splice their tokens straight into their parent, off builds every token on its own and moves it in with the same result
+
+        bool splicing = true;
+
+        // a parse that runs past any of these stops and fails with the farthest position it reached, no steps means no limit
+
+        long long maxSteps = 0;
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        const std::atomic<bool>* cancellation = nullptr;
+
+        // results parsed ahead of time, picked up by the parse instead of parsing them again
+
+        PrecomputedResults* precomputedResults = nullptr;
+
+        // filled with what this parse allocated, and added to the totals of the calling thread
+
+        ParseTelemetry* telemetry = nullptr;
+};
+
+ParserCombinator optimize(const ParserCombinator parserCombinator);
+
 ParserCombinatorResult parse(const std::string& str, const ParserCombinator parserCombinator);
+ParserCombinatorResult parse(const std::string& str, const ParserCombinator parserCombinator, const ParseOptions& options);
+
+RecognizerResult recognize(const std::string& str, const ParserCombinator parserCombinator);
+
+// every parse with telemetry on the calling thread, counts and bytes summed, peak and depth the largest of any one parse
+
+ParseTelemetry threadParseTelemetry();
+void resetThreadParseTelemetry();
+
+class RecoveredParse
+{
+    public:
+        // the tree with every recovered region in place, or the failure recovery could not get past, which is also the last failure
+
+        ParserCombinatorResult result;
+
+        std::vector<ParserFailure> failures;
+};
+
+RecoveredParse parseWithRecovery(const std::string& str, const ParserCombinator parserCombinator);
+RecoveredParse parseWithRecovery(const std::string& str, const ParserCombinator parserCombinator, const ParseOptions& options);
+
+// parses a stream of items as its chunks arrive, each item is handed out once no further input could change it and its input is then dropped,
+// an item is handed out whole, so a document that is one item, like an XML document with its single root element, comes out of finish
+// and sits in the buffer until then; given an opening and a closing, the stream steps into up to maxDepth of them and hands out
+// the opening token, the items inside one by one and the closing token instead
+
+class StreamParser
+{
+    private:
+        ParserCombinator item;
+        ParserCombinator opening;
+        ParserCombinator closing;
+
+        int maxDepth = 0;
+        int depth = 0;
+
+        std::string buffer;
+        int64_t bufferOffset = 0;
+
+        // a parse is not suspended at the end of the input, an unfinished item is parsed again from its start once its input
+        // has doubled, so a long item costs linear time overall and comes out at most its own length of input late
+        int pendingStart = -1;
+        int pendingSize = 0;
+
+        bool failed = false;
+        ParserFailure failure = ParserFailure(0);
+
+        ParserCombinatorResult parseAt(const ParserCombinator& parserCombinator, const int start, bool& inputEndReached);
+
+        std::vector<Token> parseItems(const bool final);
+
+    public:
+        StreamParser(const ParserCombinator item);
+        StreamParser(const ParserCombinator item, const ParserCombinator opening, const ParserCombinator closing, const int maxDepth);
+
+        // the items this chunk completed, positioned from the start of the stream
+
+        std::vector<Token> feed(const std::string& chunk);
+        std::vector<Token> finish();
+
+        // once an item fails nothing after it is parsed
+
+        bool hasFailed() const;
+        ParserFailure getFailure() const;
+};
+
+// moves a token and everything nested in it, for results parsed out of a piece of a longer input
+
+void offsetToken(Token& token, const int64_t offset);
+
+std::vector<ParserCombinatorResult> parseBatch(const std::vector<std::string>& strs, const ParserCombinator parserCombinator);
+std::vector<ParserCombinatorResult> parseBatch(const std::vector<std::string>& strs, const ParserCombinator parserCombinator, const ParseOptions& options);
+
+// one input parsed at many offsets across the batch workers, each parse with the same options as a whole input would get
+
+std::vector<ParserCombinatorResult> parseBatch(const std::string& str, const ParserCombinator parserCombinator, const std::vector<int>& starts);
+std::vector<ParserCombinatorResult> parseBatch(const std::string& str, const ParserCombinator parserCombinator, const std::vector<int>& starts, const ParseOptions& options);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,553 @@
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <map>
+#include <queue>
+#include <thread>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "structural.hpp"
+
+inline bool isStructural(const char c)
+{
+    return c == '<' || c == '>' || c == '/' || c == '"';
+};
+
+std::vector<int64_t> findStructuralPositions(const std::string& str)
+{
+    std::vector<int64_t> positions;
+
+    const char* data = str.data();
+
+    int64_t size = str.size();
+
+    int64_t i = 0;
+
+#ifdef __SSE2__
+    // sixteen bytes at a time, every structural byte sets one bit of the mask
+
+    const __m128i openings = _mm_set1_epi8('<');
+    const __m128i closings = _mm_set1_epi8('>');
+    const __m128i slashes = _mm_set1_epi8('/');
+    const __m128i quotes = _mm_set1_epi8('"');
+
+    for (;i + 16 <= size;i += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+        __m128i matches = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, openings), _mm_cmpeq_epi8(block, closings)),
+            _mm_or_si128(_mm_cmpeq_epi8(block, slashes), _mm_cmpeq_epi8(block, quotes))
+        );
+
+        unsigned int mask = _mm_movemask_epi8(matches);
+
+        while (mask != 0) {
+            positions.push_back(i + __builtin_ctz(mask));
+
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (;i<size;i++) {
+        if (isStructural(data[i])) positions.push_back(i);
+    }
+
+    return positions;
+};
+
+StructuralIndex indexStructure(const std::string& str)
+{
+    StructuralIndex index;
+
+    index.structuralPositions = findStructuralPositions(str);
+
+    std::vector<int64_t> openElements;
+
+    int64_t tagStart = -1;
+
+    bool quoted = false;
+
+    for (int64_t position : index.structuralPositions) {
+        char c = str[position];
+
+        if (tagStart == -1) {
+            if (c == '<') tagStart = position;
+
+            continue;
+        }
+
+        // only attribute values are quoted, anything structural inside them is text
+
+        if (c == '"') {
+            quoted = !quoted;
+
+            continue;
+        }
+
+        if (quoted || c != '>') continue;
+
+        int64_t parent = openElements.empty() ? -1 : openElements.back();
+
+        if (str[tagStart + 1] == '/') {
+            if (openElements.empty()) {
+                index.balanced = false;
+
+                return index;
+            }
+
+            index.elements[openElements.back()].end = position + 1;
+
+            openElements.pop_back();
+        } else if (str[position - 1] == '/') {
+            index.elements.push_back({ tagStart, position + 1, parent });
+        } else {
+            openElements.push_back(index.elements.size());
+
+            index.elements.push_back({ tagStart, -1, parent });
+        }
+
+        tagStart = -1;
+    }
+
+    if (!openElements.empty() || tagStart != -1) index.balanced = false;
+
+    return index;
+};
+
+// subtrees smaller than this are not worth a task of their own
+const int MINIMUM_SUBTREE_SIZE = 16 * 1024;
+
+// the parsers take int offsets, a longer input is parsed as a skeleton with every chosen subtree cut down to its opening tag
+const int64_t MAXIMUM_PARSE_SIZE = INT_MAX;
+
+// a cut input splits its subtrees below this, and copies out at most a wave of them at a time to parse them on their own
+const int64_t MAXIMUM_WINDOW_SIZE = 64 * 1024 * 1024;
+const int64_t MAXIMUM_WAVE_SIZE = 1024 * 1024 * 1024;
+
+// enough for element to mismatch on whitespace or a broken tag, far too few to parse a subtree
+const int PROBE_STEPS = 256;
+
+// splits the largest span into its children until there are enough of them to keep every worker busy,
+// a cut input also splits every span too large for a window and takes all the rest, so its skeleton stays small
+
+std::vector<int64_t> chooseSubtrees(const StructuralIndex& index, const int taskCount, const bool cutting)
+{
+    std::vector<std::vector<int64_t>> children(index.elements.size());
+
+    auto size = [&index] (const int64_t element) {
+        return index.elements[element].end - index.elements[element].start;
+    };
+
+    auto smaller = [&size] (const int64_t a, const int64_t b) {
+        return size(a) < size(b);
+    };
+
+    std::priority_queue<int64_t, std::vector<int64_t>, decltype(smaller)> subtrees(smaller);
+
+    for (int64_t i = 0;i<(int64_t) index.elements.size();i++) {
+        int64_t parent = index.elements[i].parent;
+
+        if (parent == -1) subtrees.push(i);
+        else children[parent].push_back(i);
+    }
+
+    std::vector<int64_t> chosen;
+
+    while (!subtrees.empty() && size(subtrees.top()) >= MINIMUM_SUBTREE_SIZE && ((int) (chosen.size() + subtrees.size()) < taskCount || (cutting && size(subtrees.top()) > MAXIMUM_WINDOW_SIZE))) {
+        int64_t largest = subtrees.top();
+
+        subtrees.pop();
+
+        if (children[largest].empty()) chosen.push_back(largest);
+
+        for (int64_t child : children[largest]) subtrees.push(child);
+    }
+
+    for (;!subtrees.empty();subtrees.pop()) {
+        if (cutting || size(subtrees.top()) >= MINIMUM_SUBTREE_SIZE) chosen.push_back(subtrees.top());
+    }
+
+    std::sort(chosen.begin(), chosen.end());
+
+    return chosen;
+};
+
+// where document may ask for an element, from the start of the whitespace before its '<' up to the '<'
+
+int64_t leadStart(const std::string& str, const ElementSpan& span)
+{
+    int64_t start = span.start;
+
+    while (start > 0 && std::isspace((unsigned char) str[start - 1])) start--;
+
+    return start;
+};
+
+// one past the '>' of an element's opening tag
+
+int64_t openingTagEnd(const std::string& str, const ElementSpan& span)
+{
+    bool quoted = false;
+
+    for (int64_t position = span.start;position<span.end;position++) {
+        if (str[position] == '"') quoted = !quoted;
+        else if (!quoted && str[position] == '>') return position + 1;
+    }
+
+    return span.end;
+};
+
+// what a cut input leaves out of its skeleton, everything of a chosen subtree after its opening tag, in document order
+
+class SkeletonCuts
+{
+    public:
+        std::vector<int64_t> starts;
+        std::vector<int64_t> ends;
+
+        // where each cut is in the skeleton, and how much the cuts up to and including it leave out
+        std::vector<int64_t> skeletonPositions;
+        std::vector<int64_t> removed;
+
+        void add(const int64_t start, const int64_t end)
+        {
+            int64_t removedBefore = this->removed.empty() ? 0 : this->removed.back();
+
+            this->starts.push_back(start);
+            this->ends.push_back(end);
+            this->skeletonPositions.push_back(start - removedBefore);
+            this->removed.push_back(removedBefore + end - start);
+        };
+
+        bool leftOut(const int64_t position) const
+        {
+            int64_t cut = std::upper_bound(this->starts.begin(), this->starts.end(), position) - this->starts.begin() - 1;
+
+            return cut >= 0 && position < this->ends[cut];
+        };
+
+        // a position that was left out lands where its cut is
+        int64_t toSkeleton(const int64_t position) const
+        {
+            int64_t cut = std::upper_bound(this->starts.begin(), this->starts.end(), position) - this->starts.begin() - 1;
+
+            if (cut < 0) return position;
+
+            if (position < this->ends[cut]) return this->skeletonPositions[cut];
+
+            return position - this->removed[cut];
+        };
+
+        // the position where a cut is stands for the end of what it left out
+        int64_t toInput(const int64_t position) const
+        {
+            int64_t cut = std::upper_bound(this->skeletonPositions.begin(), this->skeletonPositions.end(), position) - this->skeletonPositions.begin() - 1;
+
+            return cut < 0 ? position : position + this->removed[cut];
+        };
+
+        void mapToInput(Token& token) const
+        {
+            int64_t end = this->toInput(token.start + token.width);
+
+            token.start = this->toInput(token.start);
+            token.width = end - token.start;
+
+            if (token.type == Token::TokenType::NEST) {
+                for (Token& child : std::get<std::vector<Token>>(token.content)) this->mapToInput(child);
+            }
+        };
+};
+
+// parses element at each start, in place when the whole input fits int offsets, otherwise in a copy that ends one byte
+// past the subtree, a wave of copies at a time
+
+std::vector<ParserCombinatorResult> parseSubtrees(const std::string& str, const ParserCombinator element, const std::vector<int64_t>& starts, const std::vector<int64_t>& ends)
+{
+    if ((int64_t) str.size() <= MAXIMUM_PARSE_SIZE) return parseBatch(str, element, std::vector<int>(starts.begin(), starts.end()), ParseOptions());
+
+    std::vector<ParserCombinatorResult> results(starts.size());
+
+    size_t next = 0;
+
+    while (next < starts.size()) {
+        std::vector<std::string> windows;
+        std::vector<size_t> windowIndices;
+
+        int64_t waveSize = 0;
+
+        for (;next<starts.size() && waveSize < MAXIMUM_WAVE_SIZE;next++) {
+            int64_t windowEnd = std::min<int64_t>(str.size(), ends[next] + 1);
+
+            if (windowEnd - starts[next] > MAXIMUM_PARSE_SIZE) {
+                results[next] = ParserFailure(starts[next], "element of at most " + std::to_string(MAXIMUM_PARSE_SIZE) + " bytes");
+
+                continue;
+            }
+
+            windows.push_back(str.substr(starts[next], windowEnd - starts[next]));
+            windowIndices.push_back(next);
+
+            waveSize += windows.back().size();
+        }
+
+        std::vector<ParserCombinatorResult> windowResults = parseBatch(windows, element);
+
+        for (size_t i = 0;i<windowIndices.size();i++) {
+            int64_t offset = starts[windowIndices[i]];
+
+            if (getResultType(windowResults[i]) == ParserCombinatorResultType::TOKEN) offsetToken(std::get<Token>(windowResults[i]), offset);
+            else std::get<ParserFailure>(windowResults[i]).start += offset;
+
+            results[windowIndices[i]] = std::move(windowResults[i]);
+        }
+    }
+
+    return results;
+};
+
+// stands in for a chosen subtree while finding out where document asks for it
+const std::string subtreePlaceholderId = "PARALLEL_SUBTREE";
+
+void collectPlaceholderStarts(const Token& token, std::vector<int64_t>& starts)
+{
+    if (token.id == subtreePlaceholderId) starts.push_back(token.start);
+
+    if (token.type == Token::TokenType::NEST) {
+        for (const Token& child : token.getNestingContent()) collectPlaceholderStarts(child, starts);
+    }
+};
+
+// moves the subtree results in for their placeholders, an anonymous one splices its children in the way a parent would
+
+void fillPlaceholders(Token& token, std::map<int64_t, ParserCombinatorResult>& subtreeResults)
+{
+    if (token.type != Token::TokenType::NEST) return;
+
+    std::vector<Token>& children = std::get<std::vector<Token>>(token.content);
+
+    bool placeholders = false;
+
+    for (Token& child : children) {
+        if (child.id == subtreePlaceholderId) placeholders = true;
+        else fillPlaceholders(child, subtreeResults);
+    }
+
+    if (!placeholders) return;
+
+    std::vector<Token> filled;
+
+    for (Token& child : children) {
+        if (child.id != subtreePlaceholderId) {
+            filled.push_back(std::move(child));
+
+            continue;
+        }
+
+        Token subtree = getTokenFromResult(std::move(subtreeResults[child.start]));
+
+        if (!subtree.id.empty()) filled.push_back(std::move(subtree));
+
+        else if (subtree.type == Token::TokenType::NEST) {
+            std::vector<Token>& subtreeChildren = std::get<std::vector<Token>>(subtree.content);
+
+            filled.insert(filled.end(), std::make_move_iterator(subtreeChildren.begin()), std::make_move_iterator(subtreeChildren.end()));
+        }
+    }
+
+    children = std::move(filled);
+};
+
+ParserCombinatorResult parseParallel(const std::string& str, const ParserCombinator document, const ParserCombinator element)
+{
+    bool cutting = (int64_t) str.size() > MAXIMUM_PARSE_SIZE;
+
+    StructuralIndex index = indexStructure(str);
+
+    if (!index.balanced) {
+        if (cutting) return ParserFailure(0, "tags that nest in an input of over " + std::to_string(MAXIMUM_PARSE_SIZE) + " bytes");
+
+        return parse(str, document);
+    }
+
+    int taskCount = 4 * std::max(1, (int) std::thread::hardware_concurrency());
+
+    std::vector<int64_t> subtrees = chooseSubtrees(index, taskCount, cutting);
+
+    if (!cutting && subtrees.size() < 2) return parse(str, document);
+
+    SkeletonCuts cuts;
+
+    std::string cutSkeleton;
+
+    if (cutting) {
+        int64_t kept = 0;
+
+        for (int64_t subtree : subtrees) {
+            const ElementSpan& span = index.elements[subtree];
+
+            int64_t cutStart = openingTagEnd(str, span);
+
+            if (cutStart == span.end) continue;
+
+            cutSkeleton.append(str, kept, cutStart - kept);
+
+            cuts.add(cutStart, span.end);
+
+            kept = span.end;
+        }
+
+        cutSkeleton.append(str, kept, std::string::npos);
+
+        if ((int64_t) cutSkeleton.size() > MAXIMUM_PARSE_SIZE) return ParserFailure(0, "at most " + std::to_string(MAXIMUM_PARSE_SIZE) + " bytes outside of parallel subtrees");
+    }
+
+    const std::string& skeleton = cutting ? cutSkeleton : str;
+
+    // where document may ask for each subtree, and where the subtree ends
+
+    std::map<int64_t, int64_t> subtreeEnds;
+
+    for (int64_t subtree : subtrees) {
+        const ElementSpan& span = index.elements[subtree];
+
+        for (int64_t position = leadStart(str, span);position<=span.start;position++) subtreeEnds.emplace(position, span.end);
+    }
+
+    // which position document asks for an element at depends on how it treats the whitespace before it,
+    // so document is parsed with placeholders that skip the chosen subtrees from anywhere in their leading whitespace,
+    // the subtrees it asked for are parsed in parallel and put in place of the placeholders, and only a subtree that did not
+    // end where its tags do makes document run again with its real result
+
+    std::map<int64_t, ParserCombinatorResult> subtreeResults;
+
+    // a placeholder in the whitespace would take it for the subtree, so where element gives up within a few steps its real
+    // result is used from the start, a cut input cannot tell what element would have read and takes the extra document parse
+
+    if (!cutting) {
+        std::vector<int> probeStarts;
+
+        for (const std::pair<const int64_t, int64_t>& subtreeEnd : subtreeEnds) probeStarts.push_back(subtreeEnd.first);
+
+        ParseOptions probeOptions;
+
+        probeOptions.maxSteps = PROBE_STEPS;
+
+        std::vector<ParserCombinatorResult> probes = parseBatch(str, element, probeStarts, probeOptions);
+
+        for (size_t i = 0;i<probeStarts.size();i++) {
+            if (getResultType(probes[i]) == ParserCombinatorResultType::PARSER_FAILURE && getParserFailureFromResult(probes[i]).type != ParserFailure::ParserFailureType::MISMATCH) continue;
+
+            subtreeResults.emplace(probeStarts[i], std::move(probes[i]));
+        }
+    }
+
+    while (true) {
+        PrecomputedResults placeholders;
+
+        placeholders.parserCombinator = element;
+
+        // a failure inside a cut can only be reported where the cut is, this remembers where it really was
+
+        std::map<int64_t, int64_t> failureStarts;
+
+        for (const std::pair<const int64_t, int64_t>& subtreeEnd : subtreeEnds) {
+            int64_t position = subtreeEnd.first;
+            int64_t end = subtreeEnd.second;
+
+            int64_t skeletonPosition = cuts.toSkeleton(position);
+
+            auto subtreeResult = subtreeResults.find(position);
+
+            if (subtreeResult != subtreeResults.end() && getResultType(subtreeResult->second) == ParserCombinatorResultType::PARSER_FAILURE) {
+                ParserFailure failure = getParserFailureFromResult(subtreeResult->second);
+
+                int64_t skeletonFailureStart = cuts.toSkeleton(failure.start);
+
+                if (cuts.toInput(skeletonFailureStart) != failure.start) failureStarts[skeletonFailureStart] = failure.start;
+
+                failure.start = skeletonFailureStart;
+
+                placeholders.results.emplace(skeletonPosition, failure);
+
+                continue;
+            }
+
+            if (subtreeResult != subtreeResults.end()) end = position + getTokenFromResult(subtreeResult->second).width;
+
+            if (cuts.leftOut(end)) return ParserFailure(end, "element that ends where its tags do");
+
+            placeholders.results.emplace(skeletonPosition, Token(subtreePlaceholderId, "", skeletonPosition, cuts.toSkeleton(end) - skeletonPosition));
+        }
+
+        ParseOptions placeholderOptions;
+
+        placeholderOptions.precomputedResults = &placeholders;
+
+        ParserCombinatorResult result = parse(skeleton, document, placeholderOptions);
+
+        if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) {
+            // document may have failed before it reached the subtrees that really fail farther, without cuts parse tells for sure
+
+            if (!cutting) {
+                PrecomputedResults precomputedResults;
+
+                precomputedResults.parserCombinator = element;
+
+                for (const std::pair<const int64_t, ParserCombinatorResult>& subtreeResult : subtreeResults) precomputedResults.results.emplace(subtreeResult.first, subtreeResult.second);
+
+                ParseOptions options;
+
+                options.precomputedResults = &precomputedResults;
+
+                return parse(str, document, options);
+            }
+
+            ParserFailure failure = getParserFailureFromResult(std::move(result));
+
+            auto failureStart = failureStarts.find(failure.start);
+
+            failure.start = failureStart != failureStarts.end() ? failureStart->second : cuts.toInput(failure.start);
+
+            return failure;
+        }
+
+        Token tree = getTokenFromResult(std::move(result));
+
+        if (cutting) cuts.mapToInput(tree);
+
+        std::vector<int64_t> starts;
+
+        collectPlaceholderStarts(tree, starts);
+
+        starts.erase(std::remove_if(starts.begin(), starts.end(), [&subtreeResults] (const int64_t start) {
+            return subtreeResults.count(start) > 0;
+        }), starts.end());
+
+        std::vector<int64_t> ends;
+
+        for (int64_t start : starts) ends.push_back(subtreeEnds[start]);
+
+        std::vector<ParserCombinatorResult> results = parseSubtrees(str, element, starts, ends);
+
+        bool settled = true;
+
+        for (size_t i = 0;i<starts.size();i++) {
+            if (getResultType(results[i]) == ParserCombinatorResultType::PARSER_FAILURE || starts[i] + getTokenFromResult(results[i]).width != ends[i]) settled = false;
+
+            subtreeResults.emplace(starts[i], std::move(results[i]));
+        }
+
+        if (!settled) continue;
+
+        if (tree.id == subtreePlaceholderId) return std::move(subtreeResults[tree.start]);
+
+        fillPlaceholders(tree, subtreeResults);
+
+        return tree;
+    }
+};
@@ -0,0 +1,47 @@
+#ifndef STRUCTURAL_HPP
+#define STRUCTURAL_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parser.hpp"
+
+// an element of an XML-like document found by matching its tags, from its '<' up to one past the '>' of its closing tag
+
+class ElementSpan
+{
+    public:
+        int64_t start;
+        int64_t end;
+
+        // index into StructuralIndex::elements, -1 at the top level
+        int64_t parent;
+};
+
+// stage one of parseParallel, the structural bytes of the input and the element spans they delimit, with offsets wide enough for any input
+
+class StructuralIndex
+{
+    public:
+        // offsets of every '<', '>', '/' and '"'
+        std::vector<int64_t> structuralPositions;
+
+        // in document order, so a parent always comes before its children
+        std::vector<ElementSpan> elements;
+
+        // false when the tags do not nest, the spans are then not to be trusted
+        bool balanced = true;
+};
+
+StructuralIndex indexStructure(const std::string& str);
+
+// parses the document with the largest disjoint element subtrees left to placeholders, then those subtrees across the batch
+// workers, and puts them in place of the placeholders; a subtree that does not end where its tags do has document parse again
+// an input too long for int offsets parses a skeleton without the content of its subtrees and each subtree in a copy
+// of its own that ends one byte past it, so document must reach into subtrees only through element, and element no further
+// than one byte past its closing tag
+
+ParserCombinatorResult parseParallel(const std::string& str, const ParserCombinator document, const ParserCombinator element);
+
+#endif
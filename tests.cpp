@@ -0,0 +1,921 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <regex>
+#include <thread>
+
+#include "grammars.hpp"
+#include "lexer.hpp"
+#include "structural.hpp"
+#include "unicode.hpp"
+
+// run by make test, every check prints its failures and the exit status says whether any failed
+
+int failedChecks = 0;
+
+void check(const bool condition, const std::string description)
+{
+    if (condition) return;
+
+    failedChecks++;
+
+    std::cout << "FAILED: " << description << std::endl;
+};
+
+std::string readTestFile(const std::string path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    std::stringstream content;
+
+    content << file.rdbuf();
+
+    return content.str();
+};
+
+// results compared by value, a token by its whole tree with every position and a failure by its position
+
+std::string describeToken(const Token& token)
+{
+    std::string description = token.id + "@" + std::to_string(token.start) + "+" + std::to_string(token.width);
+
+    if (token.type == Token::TokenType::STRING_LITERAL) return description + " \"" + token.getStringLiteralContent() + "\"";
+
+    description += " {";
+
+    for (const Token& child : token.getNestingContent()) description += " " + describeToken(child);
+
+    return description + " }";
+};
+
+std::string describe(const ParserCombinatorResult& result)
+{
+    if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return "failure at " + std::to_string(getParserFailureFromResult(result).start);
+
+    return describeToken(getTokenFromResult(result));
+};
+
+std::string describeRecognized(const RecognizerResult& result)
+{
+    if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return "failure at " + std::to_string(getParserFailureFromResult(result).start);
+
+    return "width " + std::to_string(getWidthFromResult(result));
+};
+
+// what recognize should give for an input a parse gave this result for
+
+RecognizerResult recognizedFrom(const ParserCombinatorResult& result)
+{
+    if (getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE) return getParserFailureFromResult(result);
+
+    return (int) getTokenFromResult(result).width;
+};
+
+void batchTest()
+{
+    std::vector<std::string> inputs = { readTestFile("./tests/test.eval"), "eval 1 +", "", "let x = (1 + 2) * y\n" };
+
+    std::vector<ParserCombinatorResult> results = parseBatch(inputs, simpleLanguageGrammar());
+
+    for (int i = 0;i<(int)inputs.size();i++) check(describe(results[i]) == describe(parse(inputs[i], simpleLanguageGrammar())), "parseBatch matches parse on input " + std::to_string(i));
+
+    // a throwing task reaches the caller like it does from parse, and leaves the pool usable
+
+    ParserCombinator unassigned;
+
+    bool thrown = false;
+
+    try {
+        parseBatch(std::vector<std::string>(16, "a"), sequence({ satisfy(is('a')), unassigned }));
+    } catch (const std::bad_function_call&) {
+        thrown = true;
+    }
+
+    check(thrown, "parseBatch rethrows what a task threw");
+
+    ParserCombinator nestedBatch([] (const std::string& str, const int start) -> ParserCombinatorResult {
+        std::vector<ParserCombinatorResult> nestedResults = parseBatch(std::vector<std::string>(4, str.substr(start)), satisfy(is('a')).repeatedly());
+
+        return Token("NESTED", "", start, getTokenFromResult(nestedResults[0]).width);
+    });
+
+    results = parseBatch(std::vector<std::string>(16, "aaa"), nestedBatch);
+
+    check(getResultType(results[15]) == ParserCombinatorResultType::TOKEN && getTokenFromResult(results[15]).width == 3, "parseBatch runs a batch nested in a task");
+};
+
+// an input and copies of it cut short, so failures are compared as well as results
+
+std::vector<std::string> cutInputs(const std::string& input)
+{
+    std::vector<std::string> inputs;
+
+    for (int cut : { 0, 1, (int) input.size() / 3, (int) input.size() / 2, (int) input.size() - 1, (int) input.size() }) inputs.push_back(input.substr(0, std::max(0, cut)));
+
+    return inputs;
+};
+
+// every demo input and its cuts, each with the grammar it is written in
+
+std::vector<std::pair<ParserCombinator, std::string>> demoInputs()
+{
+    std::vector<std::pair<ParserCombinator, std::string>> grammarInputs;
+
+    for (const std::string& input : cutInputs(readTestFile("./tests/test.eval"))) grammarInputs.push_back({ simpleLanguageGrammar(), input });
+    for (const std::string& input : cutInputs(readTestFile("./tests/recovery.eval"))) grammarInputs.push_back({ simpleLanguageGrammar(), input });
+    for (const std::string& input : cutInputs(readTestFile("./tests/test.xml"))) grammarInputs.push_back({ xmlGrammar(), input });
+
+    return grammarInputs;
+};
+
+void optimizeTest()
+{
+    for (const std::pair<ParserCombinator, std::string>& grammarInput : demoInputs()) {
+        ParserCombinator optimized = optimize(grammarInput.first);
+
+        check(describe(parse(grammarInput.second, optimized)) == describe(parse(grammarInput.second, grammarInput.first)), "optimize keeps the result on " + std::to_string(grammarInput.second.size()) + " bytes");
+        check(describeRecognized(recognize(grammarInput.second, optimized)) == describeRecognized(recognize(grammarInput.second, grammarInput.first)), "optimize keeps recognize on " + std::to_string(grammarInput.second.size()) + " bytes");
+    }
+
+    // anonymous characters fused into runs, nested sequences flattened and character alternatives merged, none of which a token shows
+
+    ParserCombinator keyword = sequence("KEYWORD", { satisfy(is('l')), sequence({ satisfy(is('e')), string("t") }), optional(string("ter")) });
+    ParserCombinator words = repetition("WORDS", sequence({ choice({ satisfy("CHAR", is('a')), satisfy("CHAR", is('b')), keyword }) }));
+
+    for (const std::string input : { "let", "letter", "lex", "abletlet", "abletteb", "l", "" }) {
+        check(describe(parse(input, optimize(words))) == describe(parse(input, words)), "optimize keeps the result on \"" + input + "\"");
+        check(describeRecognized(recognize(input, optimize(words))) == describeRecognized(recognize(input, words)), "optimize keeps recognize on \"" + input + "\"");
+    }
+};
+
+void generatedParsersTest()
+{
+    std::vector<std::string> simpleLanguageInputs = cutInputs(readTestFile("./tests/test.eval"));
+    std::vector<std::string> recoveryInputs = cutInputs(readTestFile("./tests/recovery.eval"));
+
+    simpleLanguageInputs.insert(simpleLanguageInputs.end(), recoveryInputs.begin(), recoveryInputs.end());
+
+    for (const std::string& input : simpleLanguageInputs) {
+        check(describe(parseSimpleLanguageGenerated(input)) == describe(parse(input, simpleLanguageGrammar())), "the generated simple language parser matches on " + std::to_string(input.size()) + " bytes");
+    }
+
+    std::string xml = readTestFile("./tests/test.xml");
+
+    std::vector<std::string> xmlInputs = cutInputs(xml);
+
+    xmlInputs.push_back(xml.substr(0, xml.find("</title>")) + "<" + xml.substr(xml.find("</title>")));
+
+    for (const std::string& input : xmlInputs) {
+        check(describe(parseXmlGenerated(input)) == describe(parse(input, xmlGrammar())), "the generated XML parser matches on " + std::to_string(input.size()) + " bytes");
+    }
+};
+
+void lexerTest()
+{
+    Lexer lexer;
+
+    lexer.addRule("LET", "let");
+    lexer.addRule("IDENTIFIER", "[a-z_]\\w*");
+    lexer.addRule("NUMBER", "\\d+");
+    lexer.addRule("EQUALS", "=");
+    lexer.addSkippedRule("[ \t\n]+");
+
+    std::string keyword = "let";
+
+    bool unbuilt = false;
+
+    try {
+        lexer.tokenize(keyword);
+    } catch (const std::logic_error&) {
+        unbuilt = true;
+    }
+
+    check(unbuilt, "tokenize needs a built lexer");
+
+    lexer.build();
+
+    std::string source = "let letter = 42\nlet x = 7";
+
+    LexerResult lexerResult = lexer.tokenize(source);
+
+    check(getResultType(lexerResult) == ParserCombinatorResultType::TOKEN, "tokenize lexes a valid source");
+
+    const LexedInput& lexedInput = getLexedInputFromResult(lexerResult);
+
+    // a keyword wins over an identifier of the same length, a longer identifier wins over the keyword, skipped rules leave nothing
+
+    check(lexedInput.kinds == std::string("\x01\x02\x04\x03\x01\x02\x04\x03"), "tokenize picks the longest match and the earlier rule on ties");
+    check(lexedInput.starts == std::vector<int>({ 0, 4, 11, 13, 16, 20, 22, 24 }) && lexedInput.widths == std::vector<int>({ 3, 6, 1, 2, 3, 1, 1, 1 }), "tokenize records where every lexeme is");
+
+    ParserCombinator statement = sequence("LET_STATEMENT", { lexer.kind("LET"), lexer.kind("NAME", "IDENTIFIER"), lexer.kind("EQUALS"), lexer.kind("VALUE", "NUMBER") });
+
+    ParserCombinatorResult result = parse(lexedInput, repetition("STATEMENTS", statement));
+
+    check(getResultType(result) == ParserCombinatorResultType::TOKEN && getTokenFromResult(result).width == (int) source.size(), "combinators parse the lexemes");
+
+    if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+        const Token statements = getTokenFromResult(result);
+
+        const Token& secondStatement = statements.getNestingContent()[1];
+
+        const Token& name = secondStatement.getNestingContent()[0];
+        const Token& value = secondStatement.getNestingContent()[1];
+
+        check(secondStatement.start == 16 && secondStatement.width == 9, "token positions are mapped back to source bytes");
+        check(name.id == "NAME" && name.getStringLiteralContent() == "x" && value.id == "VALUE" && value.getStringLiteralContent() == "7", "token literals hold the source text");
+    }
+
+    // a failure on a lexeme is reported at its byte offset, a failure to lex at the first byte no rule matches
+
+    std::string mismatched = "let x = y";
+
+    ParserCombinatorResult failure = parse(getLexedInputFromResult(lexer.tokenize(mismatched)), statement);
+
+    check(getResultType(failure) == ParserCombinatorResultType::PARSER_FAILURE && getParserFailureFromResult(failure).start == 8, "a parse failure is mapped back to source bytes");
+
+    std::string unlexable = "let x = $";
+
+    LexerResult lexerFailure = lexer.tokenize(unlexable);
+
+    check(getResultType(lexerFailure) == ParserCombinatorResultType::PARSER_FAILURE && getParserFailureFromResult(lexerFailure).start == 8, "tokenize fails where no rule matches");
+
+    // a built lexer is only read, so threads share it
+
+    const Lexer& shared = lexer;
+
+    std::vector<std::string> kindsByThread(4);
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0;i<4;i++) threads.emplace_back([&shared, &source, &kindsByThread, i] { kindsByThread[i] = getLexedInputFromResult(shared.tokenize(source)).kinds; });
+
+    for (std::thread& thread : threads) thread.join();
+
+    check(std::count(kindsByThread.begin(), kindsByThread.end(), lexedInput.kinds) == 4, "threads tokenize with one shared lexer");
+};
+
+// the longest prefix std::regex matches whole, or -1 when none does
+
+int longestRegexMatch(const std::string& pattern, const std::string& input)
+{
+    std::regex expression(pattern);
+
+    for (int width = input.size();width>=0;width--) {
+        if (std::regex_match(input.begin(), input.begin() + width, expression)) return width;
+    }
+
+    return -1;
+};
+
+void regexTest()
+{
+    std::vector<std::string> patterns = { "a|ab|abc", "(ab)*c?", "\\d{2,3}", "[^a-c]+x", "\\w+\\s\\w+", "colou?r", "a{2}b{1,}", ".*;", "(a|b)*abb", "[a-c]*\\D" };
+    std::vector<std::string> inputs = { "", "a", "abc", "ababc", "1234", "zzx", "foo bar", "color", "colour", "aab", "aabbb", "x;y;\nz;", "babb", "aabbabb" };
+
+    for (const std::string& pattern : patterns) {
+        ParserCombinator match = regex("MATCH", pattern);
+
+        for (const std::string& input : inputs) {
+            int width = longestRegexMatch(pattern, input);
+
+            std::string expected = width == -1 ? "failure at 0" : describe(Token("MATCH", input.substr(0, width), 0, width));
+
+            check(describe(match(input, 0)) == expected, "regex " + pattern + " takes the longest match of \"" + input + "\"");
+        }
+    }
+
+    // running out of input only matters while some byte could still extend the match
+
+    DFA dfa = DFA::compile({ "ab|abc" });
+
+    std::vector<bool> reachedEnds;
+
+    for (const std::string input : { "a", "ab", "abc", "ab;", "b" }) {
+        int rule = -1;
+
+        bool reachedEnd;
+
+        dfa.match(input, 0, rule, reachedEnd);
+
+        reachedEnds.push_back(reachedEnd);
+    }
+
+    check(reachedEnds == std::vector<bool>({ true, true, false, false, false }), "a match reaches the end of the input only while it could still grow");
+};
+
+void recognizeTest()
+{
+    for (const std::pair<ParserCombinator, std::string>& grammarInput : demoInputs()) {
+        check(describeRecognized(recognize(grammarInput.second, grammarInput.first)) == describeRecognized(recognizedFrom(parse(grammarInput.second, grammarInput.first))), "recognize agrees with parse on " + std::to_string(grammarInput.second.size()) + " bytes");
+    }
+
+    // a combinator made from a lambda has no graph to recognize with, so it is parsed and its tokens dropped
+
+    ParserCombinator digits = repetition("DIGITS", satisfy("DIGIT", [] (const char& c) { return std::isdigit(c); }), 1);
+
+    ParserCombinator number([digits] (const std::string& str, const int start) -> ParserCombinatorResult {
+        return digits(str, start);
+    });
+
+    ParserCombinator numbers = sequence({ number, satisfy(is(',')), number });
+
+    for (const std::string input : { "12,345", "12,", ",1", "" }) {
+        check(describeRecognized(recognize(input, numbers)) == describeRecognized(recognizedFrom(parse(input, numbers))), "recognize agrees with parse through a lambda on \"" + input + "\"");
+    }
+};
+
+void skipperTest()
+{
+    ParserCombinator digit = satisfy("DIGIT", [] (const char& c) { return std::isdigit(c); });
+    ParserCombinator sum = sequence("SUM", { digit, satisfy("PLUS", is('+')), digit });
+
+    // a character class trivia is scanned from a table, a regex or lambda one is called, all of them skip the same
+
+    ParserCombinator tableTrivia = satisfy(anyOf({ is(' '), is('\t') })).repeatedly();
+    ParserCombinator regexTrivia = regex("[ \t]+");
+
+    ParserCombinator lambdaTrivia([tableTrivia] (const std::string& str, const int start) -> ParserCombinatorResult {
+        return tableTrivia(str, start);
+    });
+
+    // every leaf takes the trivia after it into its token and no trivia token is built
+
+    std::string expected = "SUM@0+8 { DIGIT@0+2 \"1\" PLUS@2+3 \"+\" DIGIT@5+3 \"2\" }";
+
+    for (const ParserCombinator& trivia : { tableTrivia, regexTrivia, lambdaTrivia }) {
+        ParserCombinator skippingSum = skipping(trivia, sum);
+
+        check(describe(parse("1 +  2  ", skippingSum)) == expected, "skipping widens leaves over the trivia after them");
+        check(describe(parse("1+2", skippingSum)) == "SUM@0+3 { DIGIT@0+1 \"1\" PLUS@1+1 \"+\" DIGIT@2+1 \"2\" }", "skipping without trivia parses as without a skipper");
+        check(describe(parse("1 + x", skippingSum)) == "failure at 4", "skipping fails at the first char after the trivia");
+        check(describeRecognized(recognize("1 +  2  ", skippingSum)) == "width 8", "recognize skips the same trivia");
+    }
+
+    // without lexeme the letters of a name skip the trivia between names too
+
+    ParserCombinator letter = satisfy([] (const char& c) { return std::isalpha(c); });
+
+    ParserCombinator names = skipping(tableTrivia, sequence("NAMES", { lexeme(repetition("NAME", letter, 1)), lexeme(repetition("NAME", letter, 1)) }));
+    ParserCombinator runTogetherNames = skipping(tableTrivia, sequence("NAMES", { repetition("NAME", letter, 1), repetition("NAME", letter, 1) }));
+
+    check(describe(parse("ab cd ", names)) == "NAMES@0+6 { NAME@0+3 { } NAME@3+3 { } }", "lexeme keeps trivia out of its child");
+    check(describe(parse("ab cd ", runTogetherNames)) == "failure at 6", "without lexeme trivia is skipped inside a name");
+};
+
+void spanTest()
+{
+    ParserCombinator identifier = sequence("IDENTIFIER", {
+        satisfy("CHAR", [] (const char& c) { return std::isalpha(c) || c == '_'; }),
+        repetition(satisfy("CHAR", [] (const char& c) { return std::isalnum(c) || c == '_'; }))
+    });
+
+    // one literal of the matched text in place of the tree, matching and failing where the tree does
+
+    for (const std::string input : { "snake_case42 rest", "x", "_", "9lives", "" }) {
+        ParserCombinatorResult tree = parse(input, identifier);
+        ParserCombinatorResult spanned = parse(input, span("NAME", identifier));
+
+        std::string expected = describe(tree);
+
+        if (getResultType(tree) == ParserCombinatorResultType::TOKEN) {
+            const Token token = getTokenFromResult(tree);
+
+            expected = describe(Token("NAME", input.substr(token.start, token.width), token.start, token.width));
+        }
+
+        check(describe(spanned) == expected, "span matches like its child on \"" + input + "\"");
+        check(describe(parse(input, identifier.asSpan("NAME"))) == describe(spanned), "asSpan is span on \"" + input + "\"");
+    }
+
+    // inside skipping the literal stops at the match and the token covers the trivia after it
+
+    ParserCombinator assignment = skipping(satisfy(is(' ')).repeatedly(), sequence("ASSIGNMENT", { span("NAME", identifier), satisfy("EQUALS", is('=')) }));
+
+    check(describe(parse("answer   = ", assignment)) == "ASSIGNMENT@0+11 { NAME@0+9 \"answer\" EQUALS@9+2 \"=\" }", "a skipped span keeps its trivia out of its literal");
+};
+
+// the ids of every token in a tree, in document order
+
+void collectTokenIds(const Token& token, std::vector<std::string>& tokenIds)
+{
+    tokenIds.push_back(token.id);
+
+    if (token.type == Token::TokenType::NEST) {
+        for (const Token& child : token.getNestingContent()) collectTokenIds(child, tokenIds);
+    }
+};
+
+// the tokens a full parse keeps under the given ids, where a dropped token hands its children up
+
+void collectCapturedTokenIds(const Token& token, const std::vector<std::string>& capturedTokenIds, std::vector<std::string>& tokenIds)
+{
+    bool captured = std::find(capturedTokenIds.begin(), capturedTokenIds.end(), token.id) != capturedTokenIds.end();
+
+    if (captured) tokenIds.push_back(token.id);
+
+    if (token.type == Token::TokenType::NEST) {
+        for (const Token& child : token.getNestingContent()) collectCapturedTokenIds(child, capturedTokenIds, tokenIds);
+    }
+};
+
+void captureTest()
+{
+    std::string xml = readTestFile("./tests/test.xml");
+
+    const Token fullToken = getTokenFromResult(parse(xml, xmlGrammar()));
+
+    std::vector<std::string> tokenIds = { "NESTING_TAG", "OPENING_TAG", "CLOSING_TAG", "SELF_CLOSING_TAG", "TAG_NAME", "ATTRIBUTES", "KEY", "VALUE", "TEXT", "CHILDREN", "CHAR" };
+
+    // more id sets than the cache holds, each parsed twice so evicted grammars are rewritten again
+
+    for (int round = 0;round<2;round++) {
+        for (int i = 0;i<(int)tokenIds.size();i++) {
+            for (int j = i;j<(int)tokenIds.size();j += 3) {
+                ParseOptions options;
+
+                options.capturedTokenIds = { tokenIds[i], tokenIds[j] };
+
+                ParserCombinatorResult result = parse(xml, xmlGrammar(), options);
+
+                std::vector<std::string> expectedIds;
+                std::vector<std::string> capturedIds;
+
+                collectCapturedTokenIds(fullToken, options.capturedTokenIds, expectedIds);
+
+                if (getResultType(result) == ParserCombinatorResultType::TOKEN) {
+                    const Token& token = getTokenFromResult(result);
+
+                    if (token.id.empty() && token.type == Token::TokenType::NEST) {
+                        for (const Token& child : token.getNestingContent()) collectTokenIds(child, capturedIds);
+                    }
+                    else collectTokenIds(token, capturedIds);
+                }
+
+                check(capturedIds == expectedIds, "capturing " + tokenIds[i] + " and " + tokenIds[j] + " keeps exactly those tokens");
+            }
+        }
+    }
+
+    // a rule reassigned behind a proxy is rewritten again once the cache is cleared
+
+    ParserCombinator rule = satisfy("A", is('a'));
+    ParserCombinator root = sequence("ROOT", { proxyParserCombinator(&rule) });
+
+    ParseOptions options;
+
+    options.capturedTokenIds = { "ROOT", "A", "B" };
+
+    check(describe(parse("a", root, options)) == describe(parse("a", root)), "capturing follows a proxy");
+
+    rule = satisfy("B", is('b'));
+
+    clearCapturedGrammars();
+
+    check(describe(parse("b", root, options)) == describe(parse("b", root)), "capturing follows a reassigned proxy after clearing the cache");
+};
+
+void splicingTest()
+{
+    // with splicing off every child builds its own token and moves it into its parent, which has to come out the same
+
+    ParseOptions unspliced;
+
+    unspliced.splicing = false;
+
+    for (const std::pair<ParserCombinator, std::string>& grammarInput : demoInputs()) {
+        check(describe(parse(grammarInput.second, grammarInput.first)) == describe(parse(grammarInput.second, grammarInput.first, unspliced)), "splicing keeps the result on " + std::to_string(grammarInput.second.size()) + " bytes");
+    }
+
+    // a lexeme widens its token over the trivia after it, also where it is spliced into a sequence
+
+    ParserCombinator letter = satisfy([] (const char& c) { return std::isalpha(c); });
+    ParserCombinator whitespace = satisfy(anyOf({ is(' '), is('\t') })).repeatedly();
+
+    ParserCombinator names = skipping(whitespace, sequence("NAMES", {
+        lexeme(repetition("NAME", letter, 1)),
+        sequence({ lexeme(repetition("NAME", letter, 1)), span("WORD", letter.repeatedly(1)) })
+    }));
+
+    for (const std::string input : { "ab cd ef  ", "ab\tcd ef", "ab cd", "ab" }) {
+        check(describe(parse(input, names)) == describe(parse(input, names, unspliced)), "splicing keeps the widths of lexemes on \"" + input + "\"");
+    }
+};
+
+bool failedWith(const ParserCombinatorResult& result, const ParserFailure::ParserFailureType type)
+{
+    return getResultType(result) == ParserCombinatorResultType::PARSER_FAILURE && getParserFailureFromResult(result).type == type;
+};
+
+void budgetTest()
+{
+    // budgets that are never hit leave the parse alone
+
+    std::string program = readTestFile("./tests/test.eval");
+
+    std::atomic<bool> cancellation(false);
+
+    ParseOptions generous;
+
+    generous.maxSteps = 1000000000;
+    generous.deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    generous.cancellation = &cancellation;
+
+    check(describe(parse(program, simpleLanguageGrammar(), generous)) == describe(parse(program, simpleLanguageGrammar())), "a budget that is not hit keeps the result");
+
+    // every a could start any of three alternatives, so this backtracks for longer than any test runs
+
+    ParserCombinator exponential;
+
+    ParserCombinator a = satisfy(is('a'));
+
+    exponential = choice({
+        sequence({ a, proxyParserCombinator(&exponential), satisfy(is('b')) }),
+        sequence({ a, proxyParserCombinator(&exponential), satisfy(is('c')) }),
+        sequence({ a, proxyParserCombinator(&exponential) }),
+        a
+    });
+
+    std::string input = std::string(40, 'a') + "d";
+
+    ParseOptions steps;
+
+    steps.maxSteps = 100000;
+
+    ParserCombinatorResult result = parse(input, exponential, steps);
+
+    check(failedWith(result, ParserFailure::ParserFailureType::STEP_LIMIT) && getParserFailureFromResult(result).start > 0 && getParserFailureFromResult(result).start <= 40, "a step limit stops the parse at the farthest position it reached");
+
+    ParseOptions deadline;
+
+    deadline.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+
+    check(failedWith(parse(input, exponential, deadline), ParserFailure::ParserFailureType::DEADLINE), "a deadline stops the parse");
+
+    ParseOptions cancelled;
+
+    cancelled.cancellation = &cancellation;
+
+    std::thread canceller([&cancellation] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        cancellation = true;
+    });
+
+    result = parse(input, exponential, cancelled);
+
+    canceller.join();
+
+    check(failedWith(result, ParserFailure::ParserFailureType::CANCELLED), "cancelling from another thread stops the parse");
+
+    // every parse of a batch runs on the same budget options, a parse that does not hit them is unchanged
+
+    std::vector<ParserCombinatorResult> results = parseBatch({ program, input }, exponential, steps);
+
+    check(describe(results[0]) == describe(parse(program, exponential)) && failedWith(results[1], ParserFailure::ParserFailureType::STEP_LIMIT), "parseBatch applies the budget to each parse");
+
+    std::string prefixed = "ab" + input;
+
+    results = parseBatch(prefixed, exponential, { 0, 2 }, steps);
+
+    check(describe(results[0]) == describe(exponential(prefixed, 0)) && failedWith(results[1], ParserFailure::ParserFailureType::STEP_LIMIT), "parseBatch at offsets applies the budget to each parse");
+};
+
+void recoveryTest()
+{
+    // two broken statements, each failing after the point where its block starts
+
+    std::string program = readTestFile("./tests/recovery.eval");
+
+    RecoveredParse recovered = parseWithRecovery(program, simpleLanguageGrammar());
+
+    check(getResultType(recovered.result) == ParserCombinatorResultType::TOKEN, "a program with broken blocks still parses");
+
+    std::vector<int> failurePositions;
+
+    for (const ParserFailure& parserFailure : recovered.failures) failurePositions.push_back(parserFailure.start);
+
+    // the missing variable of the first let, the missing operand at the end of the first line, the unclosed group of the second let
+
+    check(failurePositions == std::vector<int>({ 4, 17, 28 }), "recovered failures point into the broken blocks");
+
+    check(parseWithRecovery("let x = 1; eval x", simpleLanguageGrammar()).failures.empty(), "a valid program recovers nothing");
+};
+
+// the tokens a stream hands out in order, the ones handed out before finish kept apart
+
+std::vector<std::string> streamTokens(StreamParser& streamParser, const std::string& input, const int chunkSize, int& describedBeforeFinish, int& maxUnhandled)
+{
+    std::vector<std::string> tokens;
+
+    int handledEnd = 0;
+
+    maxUnhandled = 0;
+
+    for (int position = 0;position<(int) input.size();position += chunkSize) {
+        for (const Token& token : streamParser.feed(input.substr(position, chunkSize))) {
+            tokens.push_back(describe(token));
+
+            handledEnd = token.start + token.width;
+        }
+
+        maxUnhandled = std::max(maxUnhandled, std::min(position + chunkSize, (int) input.size()) - handledEnd);
+    }
+
+    describedBeforeFinish = tokens.size();
+
+    for (const Token& token : streamParser.finish()) tokens.push_back(describe(token));
+
+    return tokens;
+};
+
+void streamTest()
+{
+    std::string xml = readTestFile("./tests/test.xml");
+
+    // stepping into the root hands out its opening tag, each child and its closing tag, and anything around the root as it is
+
+    ParserCombinatorResult full = parse(xml, xmlGrammar());
+
+    const Token& root = getTokenFromResult(full).getNestingContent()[0];
+
+    std::vector<std::string> expected;
+
+    for (const Token& token : getTokenFromResult(full).getNestingContent()) {
+        if (token.id != "NESTING_TAG") {
+            expected.push_back(describe(token));
+
+            continue;
+        }
+
+        expected.push_back(describe(token.getNestingContent()[0]));
+
+        for (const Token& child : token.getNestingContent()[1].getNestingContent()) expected.push_back(describe(child));
+
+        expected.push_back(describe(token.getNestingContent()[2]));
+    }
+
+    int handedOutBeforeFinish = 0;
+    int maxUnhandled = 0;
+
+    for (int chunkSize : { 1, 7, 64, (int) xml.size() }) {
+        StreamParser streamParser(xmlChildGrammar(), xmlOpeningTagGrammar(), xmlClosingTagGrammar(), 1);
+
+        std::vector<std::string> tokens = streamTokens(streamParser, xml, chunkSize, handedOutBeforeFinish, maxUnhandled);
+
+        check(tokens == expected && !streamParser.hasFailed(), "streaming test.xml in chunks of " + std::to_string(chunkSize) + " hands out the children of the root");
+    }
+
+    // a root far larger than its children never holds much more than a child and a chunk
+
+    std::string children = xml.substr(xml.find('\n') + 1, xml.rfind("</root>") - xml.find('\n') - 1);
+
+    std::string document = "<root>\n";
+
+    for (int i = 0;i<256;i++) document += children;
+
+    document += "</root>\n";
+
+    StreamParser streamParser(xmlChildGrammar(), xmlOpeningTagGrammar(), xmlClosingTagGrammar(), 1);
+
+    std::vector<std::string> tokens = streamTokens(streamParser, document, 4096, handedOutBeforeFinish, maxUnhandled);
+
+    check(!streamParser.hasFailed() && (int) tokens.size() == 2 + 256 * 4 + 1 + 1 && handedOutBeforeFinish == (int) tokens.size() - 1, "a large root is handed out child by child as it arrives");
+    check(maxUnhandled < 4096 + (int) children.size(), "a large root is not held in the buffer");
+
+    // without stepping in the root is a single item
+
+    StreamParser itemStreamParser(xmlChildGrammar());
+
+    tokens = streamTokens(itemStreamParser, xml, 7, handedOutBeforeFinish, maxUnhandled);
+
+    check(!tokens.empty() && tokens[0] == describe(root) && !itemStreamParser.hasFailed(), "a stream of roots hands out each root whole");
+
+    StreamParser unclosedStreamParser(xmlChildGrammar(), xmlOpeningTagGrammar(), xmlClosingTagGrammar(), 1);
+
+    streamTokens(unclosedStreamParser, "<root>\n  <a>x</a>\n", 4, handedOutBeforeFinish, maxUnhandled);
+
+    check(unclosedStreamParser.hasFailed() && unclosedStreamParser.getFailure().start == 18, "a stream that ends inside the root fails where the closing tag is missing");
+
+    // a lambda cannot mark the input end, so an item it ends at the end of the buffer waits for more input
+
+    ParserCombinator word([] (const std::string& str, const int start) -> ParserCombinatorResult {
+        int end = start;
+
+        while (end < (int) str.size() && std::isalpha(str[end])) end++;
+
+        if (end < (int) str.size() && str[end] == ';') end++;
+
+        if (end == start) return ParserFailure(start);
+
+        return Token("WORD", str.substr(start, end - start), start, end - start);
+    });
+
+    StreamParser wordStreamParser(word);
+
+    tokens = streamTokens(wordStreamParser, "ab;cd;ef", 1, handedOutBeforeFinish, maxUnhandled);
+
+    check(tokens == std::vector<std::string>({ describe(Token("WORD", "ab;", 0, 3)), describe(Token("WORD", "cd;", 3, 3)), describe(Token("WORD", "ef", 6, 2)) }), "a lambda item that stops at the end of a chunk waits for the rest");
+};
+
+void parallelTest()
+{
+    std::string xml = readTestFile("./tests/test.xml");
+
+    StructuralIndex index = indexStructure(xml);
+
+    check(index.balanced && index.elements.size() == 11 && index.elements[0].parent == -1 && index.elements[0].end == (int64_t) xml.find_last_of('>') + 1, "indexStructure finds the elements of test.xml");
+
+    check(!indexStructure("<a><b></a>").balanced, "indexStructure notices tags that do not nest");
+
+    // groups large enough to be parsed ahead, nested in a root and at the top level behind indentation
+
+    std::string group;
+
+    while (group.size() < 16 * 1024) group += xml;
+
+    std::string nested = "<groups>\n";
+
+    for (int i = 0;i<3;i++) nested += "  <group>" + group + "</group>\n";
+
+    nested += "</groups>\n";
+
+    std::string indented = "  <first>" + group + "</first>\n\t<second>" + group + "</second>\n";
+
+    std::string broken = nested;
+
+    broken[broken.size() / 2] = '<';
+
+    // tags that still nest around a broken attribute, so the failure comes from a subtree
+
+    std::string brokenAttribute = nested;
+
+    brokenAttribute[brokenAttribute.find('=', brokenAttribute.size() / 2)] = ' ';
+
+    for (const std::string& document : { nested, indented, broken, brokenAttribute }) {
+        check(describe(parseParallel(document, xmlGrammar(), xmlElementGrammar())) == describe(parse(document, xmlGrammar())), "parseParallel matches parse on " + std::to_string(document.size()) + " bytes");
+    }
+
+    // the subtrees go into the tree document built around their placeholders, so document runs once
+
+    int documentParses = 0;
+
+    ParserCombinator countedDocument([&documentParses] (const std::string& str, const int start) -> ParserCombinatorResult {
+        documentParses++;
+
+        return xmlGrammar()(str, start);
+    });
+
+    check(describe(parseParallel(nested, countedDocument, xmlElementGrammar())) == describe(parse(nested, xmlGrammar())) && documentParses == 1, "parseParallel parses the document around its subtrees once");
+};
+
+void telemetryTest()
+{
+    std::string xml = readTestFile("./tests/test.xml");
+
+    ParseTelemetry telemetry;
+
+    ParseOptions options;
+
+    options.telemetry = &telemetry;
+
+    ParserCombinatorResult result = parse(xml, xmlGrammar(), options);
+
+    std::vector<std::string> tokenIds;
+
+    collectTokenIds(getTokenFromResult(result), tokenIds);
+
+    check(telemetry.nodesCreated - telemetry.nodesDiscarded == (long long) tokenIds.size(), "telemetry counts the tokens of the result as created and not discarded");
+    check(telemetry.bytesAllocated >= telemetry.peakLiveBytes && telemetry.peakLiveBytes > 0 && telemetry.maxDepth > 0 && telemetry.parses == 1, "telemetry of a parse is filled in");
+
+    // short ids and literals are stored inline and allocate nothing
+
+    parse("a", satisfy("CHAR", is('a')), options);
+
+    check(telemetry.nodesCreated == 1 && telemetry.bytesAllocated == 0, "a token with short strings allocates nothing");
+
+    std::string longId(64, 'A');
+
+    parse("a", satisfy(longId, is('a')), options);
+
+    check(telemetry.bytesAllocated > (long long) longId.size(), "a token with a long id counts its allocation");
+
+    // the shorter alternative of a choice and the children of a sequence that fails are built and then dropped
+
+    ParserCombinator longestWord = choice({ repetition("SHORT", satisfy("CHAR", is('a')), 1, 2), repetition("LONG", satisfy("CHAR", is('a')), 1) });
+
+    parse("aaaa", longestWord, options);
+
+    check(telemetry.nodesCreated == 8 && telemetry.nodesDiscarded == 3, "telemetry counts the tokens of a dropped alternative as discarded");
+
+    ParserCombinator pairOrChar = choice({ sequence("PAIR", { satisfy("A", is('a')), satisfy("B", is('b')) }), satisfy("A", is('a')) });
+
+    parse("ac", pairOrChar, options);
+
+    check(telemetry.nodesCreated == 2 && telemetry.nodesDiscarded == 1, "telemetry counts the children of a failed sequence as discarded");
+
+    // tokens are counted where combinators build them, so a copy is neither another node nor another allocation
+
+    ParserCombinator word = repetition("WORD", satisfy("CHAR", is('a')), 1);
+
+    ParserCombinator copyingWord([word] (const std::string& str, const int start) -> ParserCombinatorResult {
+        ParserCombinatorResult wordResult = word(str, start);
+
+        if (getResultType(wordResult) == ParserCombinatorResultType::PARSER_FAILURE) return wordResult;
+
+        Token copy = getTokenFromResult(wordResult);
+
+        return copy;
+    });
+
+    parse("aaaa", word, options);
+
+    long long wordNodes = telemetry.nodesCreated;
+    long long wordBytes = telemetry.bytesAllocated;
+
+    parse("aaaa", copyingWord, options);
+
+    check(telemetry.nodesCreated == wordNodes && telemetry.nodesDiscarded == 0, "copying a token does not count it as created");
+    check(telemetry.bytesAllocated == wordBytes, "copying a token does not count what the copy allocated");
+};
+
+void unicodeTest()
+{
+    // one code point of each width, then sequences that are overlong, surrogates, past U+10FFFF or cut off
+
+    std::vector<std::pair<std::string, char32_t>> wellFormed = { { "A", U'A' }, { "\xC3\xA9", U'\u00E9' }, { "\xE4\xB8\xAD", U'\u4E2D' }, { "\xF0\x9F\x98\x80", U'\U0001F600' } };
+
+    for (const std::pair<std::string, char32_t>& sequence : wellFormed) {
+        char32_t codePoint = 0;
+
+        check(decodeUtf8(sequence.first + "!", 0, codePoint) == (int) sequence.first.size() && codePoint == sequence.second, "decodeUtf8 decodes a " + std::to_string(sequence.first.size()) + " byte sequence");
+    }
+
+    for (const std::string malformed : { "\xC0\xAF", "\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xE4\xB8", "\x80", "\xFF" }) {
+        char32_t codePoint = 0;
+
+        check(decodeUtf8(malformed, 0, codePoint) == 0, "decodeUtf8 rejects a malformed sequence");
+    }
+
+    std::vector<std::pair<char32_t, UnicodeCategory>> categories = {
+        { U'A', UPPERCASE_LETTER }, { U'a', LOWERCASE_LETTER }, { U'\u01C5', TITLECASE_LETTER }, { U'\u4E2D', OTHER_LETTER },
+        { U'\u0301', NONSPACING_MARK }, { U'\u0663', DECIMAL_NUMBER }, { U'\u20AC', CURRENCY_SYMBOL }, { U'\U0001F600', OTHER_SYMBOL },
+        { U'\u00A0', SPACE_SEPARATOR }, { U'\u2028', LINE_SEPARATOR }, { U'\uE000', PRIVATE_USE }, { U'\u0378', UNASSIGNED }
+    };
+
+    for (const std::pair<char32_t, UnicodeCategory>& category : categories) {
+        check(unicodeCategory(category.first) == category.second, "unicodeCategory of U+" + std::to_string((unsigned int) category.first) + " is " + std::to_string(category.second));
+    }
+
+    // tokens hold the bytes and positions are byte offsets, the table run and a plain predicate agree
+
+    CodePointPredicate isLetter = inCategories({ UPPERCASE_LETTER, LOWERCASE_LETTER, TITLECASE_LETTER, MODIFIER_LETTER, OTHER_LETTER });
+
+    CodePointPredicate isLetterCalled = [] (const char32_t& codePoint) {
+        UnicodeCategory category = unicodeCategory(codePoint);
+
+        return category <= OTHER_LETTER;
+    };
+
+    ParserCombinator word = satisfyCodePoint(isLetter).repeatedly(1).asSpan("WORD");
+    ParserCombinator calledWord = satisfyCodePoint(isLetterCalled).repeatedly(1).asSpan("WORD");
+
+    for (const std::string input : { "h\xC3\xA9llo w\xC3\xB6rld", "\xE4\xB8\xAD\xE6\x96\x87!", "abcdefghijklmnopqrstuvwxyz\xC3\xA9", "1a", "\xC3", "" }) {
+        check(describe(parse(input, word)) == describe(parse(input, calledWord)), "satisfyCodePoint runs agree on \"" + input + "\"");
+        check(describeRecognized(recognize(input, word)) == describeRecognized(recognize(input, calledWord)), "satisfyCodePoint recognize agrees on \"" + input + "\"");
+    }
+
+    check(describe(parse("h\xC3\xA9llo w\xC3\xB6rld", word)) == "WORD@0+6 \"h\xC3\xA9llo\"", "a code point run stops at the first non member");
+    check(describe(parse("\xC3\xA9", satisfyCodePoint("LETTER", isLetter))) == "LETTER@0+2 \"\xC3\xA9\"", "a code point token holds its bytes");
+    check(describe(parse("\xC3(", satisfyCodePoint("LETTER", isLetter))) == "failure at 0", "a malformed sequence never matches");
+};
+
+int main()
+{
+    batchTest();
+    optimizeTest();
+    generatedParsersTest();
+    lexerTest();
+    regexTest();
+    recognizeTest();
+    skipperTest();
+    spanTest();
+    captureTest();
+    splicingTest();
+    budgetTest();
+    recoveryTest();
+    streamTest();
+    parallelTest();
+    telemetryTest();
+    unicodeTest();
+
+    if (failedChecks > 0) {
+        std::cout << failedChecks << " checks failed" << std::endl;
+
+        return 1;
+    }
+
+    std::cout << "all checks passed" << std::endl;
+
+    return 0;
+};
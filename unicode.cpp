@@ -0,0 +1,214 @@
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "unicode.hpp"
+#include "unicode_tables.hpp"
+
+UnicodeCategory unicodeCategory(const char32_t codePoint)
+{
+    if (codePoint >= 0x110000) return UnicodeCategory::UNASSIGNED;
+
+    int row = unicodeCategoryRows[codePoint >> (unicodeBlockShift + unicodeRowShift)];
+    int block = unicodeCategoryBlockIndices[(row << unicodeRowShift) + ((codePoint >> unicodeBlockShift) & ((1 << unicodeRowShift) - 1))];
+
+    return (UnicodeCategory) unicodeCategoryBlocks[(block << unicodeBlockShift) + (codePoint & ((1 << unicodeBlockShift) - 1))];
+};
+
+inline bool isContinuationByte(const unsigned char byte)
+{
+    return (byte & 0xC0) == 0x80;
+};
+
+int decodeUtf8(const std::string& str, const int start, char32_t& codePoint)
+{
+    int size = str.size();
+
+    if (start >= size) return 0;
+
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(str.data()) + start;
+
+    unsigned char lead = bytes[0];
+
+    if (lead < 0x80) {
+        codePoint = lead;
+
+        return 1;
+    }
+
+    // the second byte range of E0, ED, F0 and F4 rules out overlong forms, surrogates and code points past U+10FFFF
+
+    if (lead < 0xC2 || lead > 0xF4) return 0;
+
+    if (lead < 0xE0) {
+        if (start + 1 >= size || !isContinuationByte(bytes[1])) return 0;
+
+        codePoint = ((lead & 0x1F) << 6) | (bytes[1] & 0x3F);
+
+        return 2;
+    }
+
+    unsigned char secondMin = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+    unsigned char secondMax = lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF;
+
+    if (start + 1 >= size || bytes[1] < secondMin || bytes[1] > secondMax) return 0;
+
+    if (lead < 0xF0) {
+        if (start + 2 >= size || !isContinuationByte(bytes[2])) return 0;
+
+        codePoint = ((lead & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6) | (bytes[2] & 0x3F);
+
+        return 3;
+    }
+
+    if (start + 3 >= size || !isContinuationByte(bytes[2]) || !isContinuationByte(bytes[3])) return 0;
+
+    codePoint = ((lead & 0x07) << 18) | ((bytes[1] & 0x3F) << 12) | ((bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+
+    return 4;
+};
+
+// bytes a sequence claims by its lead byte, 1 for bytes no sequence starts with
+
+inline int sequenceLength(const unsigned char lead)
+{
+    if (lead >= 0xF0) return 4;
+
+    if (lead >= 0xE0) return 3;
+
+    if (lead >= 0xC0) return 2;
+
+    return 1;
+};
+
+UnicodeCategories::UnicodeCategories(unsigned int categories)
+{
+    this->categories = categories;
+};
+
+bool UnicodeCategories::operator()(const char32_t& codePoint) const
+{
+    return (this->categories >> unicodeCategory(codePoint)) & 1;
+};
+
+CodePointPredicate inCategories(const std::vector<UnicodeCategory> categories)
+{
+    unsigned int mask = 0;
+
+    for (UnicodeCategory category : categories) mask |= 1u << category;
+
+    return UnicodeCategories(mask);
+};
+
+CodePointClass::CodePointClass(const CodePointPredicate predicate)
+{
+    this->predicate = predicate;
+
+    const UnicodeCategories* unicodeCategories = predicate.target<UnicodeCategories>();
+
+    if (unicodeCategories != nullptr) {
+        this->byCategory = true;
+        this->categories = unicodeCategories->categories;
+    }
+
+    for (char32_t c = 0;c<128;c++) if (this->contains(c)) this->asciiMembers.set(c);
+};
+
+bool CodePointClass::contains(const char32_t codePoint) const
+{
+    if (this->byCategory) return (this->categories >> unicodeCategory(codePoint)) & 1;
+
+    return this->predicate(codePoint);
+};
+
+int CodePointClass::match(const std::string& str, const int start, bool& reachedEnd) const
+{
+    int size = str.size();
+
+    reachedEnd = false;
+
+    if (start >= size) {
+        reachedEnd = true;
+
+        return 0;
+    }
+
+    unsigned char lead = str[start];
+
+    if (lead < 0x80) return this->asciiMembers[lead] ? 1 : 0;
+
+    if (start + sequenceLength(lead) > size) reachedEnd = true;
+
+    char32_t codePoint;
+
+    int width = decodeUtf8(str, start, codePoint);
+
+    if (width == 0 || !this->contains(codePoint)) return 0;
+
+    return width;
+};
+
+int CodePointClass::matchRun(const std::string& str, const int start, const int maxCount, int& count, bool& reachedEnd) const
+{
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(str.data());
+
+    int size = str.size();
+
+    int position = start;
+
+    count = 0;
+    reachedEnd = false;
+
+    while (count < maxCount) {
+        if (position >= size) {
+            reachedEnd = true;
+
+            break;
+        }
+
+#ifdef __SSE2__
+        // no byte of the block has its high bit set, so all sixteen are ASCII and only the table is read
+
+        if (position + 16 <= size && maxCount - count >= 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+
+            if (_mm_movemask_epi8(block) == 0) {
+                int members = 0;
+
+                while (members < 16 && this->asciiMembers[data[position + members]]) members++;
+
+                position += members;
+                count += members;
+
+                if (members < 16) break;
+
+                continue;
+            }
+        }
+#endif
+
+        unsigned char lead = data[position];
+
+        if (lead < 0x80) {
+            if (!this->asciiMembers[lead]) break;
+
+            position++;
+            count++;
+
+            continue;
+        }
+
+        bool sequenceReachedEnd;
+
+        int width = this->match(str, position, sequenceReachedEnd);
+
+        if (sequenceReachedEnd) reachedEnd = true;
+
+        if (width == 0) break;
+
+        position += width;
+        count++;
+    }
+
+    return position;
+};
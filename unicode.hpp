@@ -0,0 +1,93 @@
+#ifndef UNICODE_HPP
+#define UNICODE_HPP
+
+#include <string>
+#include <vector>
+#include <bitset>
+
+#include "parser.hpp"
+
+// general categories in the order of the Unicode character database, code points it does not assign are UNASSIGNED
+
+enum UnicodeCategory {
+    UPPERCASE_LETTER,
+    LOWERCASE_LETTER,
+    TITLECASE_LETTER,
+    MODIFIER_LETTER,
+    OTHER_LETTER,
+    NONSPACING_MARK,
+    SPACING_MARK,
+    ENCLOSING_MARK,
+    DECIMAL_NUMBER,
+    LETTER_NUMBER,
+    OTHER_NUMBER,
+    CONNECTOR_PUNCTUATION,
+    DASH_PUNCTUATION,
+    OPEN_PUNCTUATION,
+    CLOSE_PUNCTUATION,
+    INITIAL_PUNCTUATION,
+    FINAL_PUNCTUATION,
+    OTHER_PUNCTUATION,
+    MATH_SYMBOL,
+    CURRENCY_SYMBOL,
+    MODIFIER_SYMBOL,
+    OTHER_SYMBOL,
+    SPACE_SEPARATOR,
+    LINE_SEPARATOR,
+    PARAGRAPH_SEPARATOR,
+    CONTROL,
+    FORMAT,
+    SURROGATE,
+    PRIVATE_USE,
+    UNASSIGNED
+};
+
+UnicodeCategory unicodeCategory(const char32_t codePoint);
+
+// width in bytes of the well formed UTF-8 sequence at start, 0 for anything else, including a sequence cut off by the end of str
+
+int decodeUtf8(const std::string& str, const int start, char32_t& codePoint);
+
+// tabulated code point predicate, inCategories predicates stay inspectable as one of these
+
+class UnicodeCategories
+{
+    public:
+        unsigned int categories = 0;
+
+        UnicodeCategories() = default;
+
+        UnicodeCategories(unsigned int categories);
+
+        bool operator()(const char32_t& codePoint) const;
+};
+
+CodePointPredicate inCategories(const std::vector<UnicodeCategory> categories);
+
+// what satisfyCodePoint matches with, ASCII is answered from a table and categories without calling through std::function
+
+class CodePointClass
+{
+    public:
+        CodePointPredicate predicate;
+
+        std::bitset<128> asciiMembers;
+
+        bool byCategory = false;
+        unsigned int categories = 0;
+
+        CodePointClass(const CodePointPredicate predicate);
+
+        bool contains(const char32_t codePoint) const;
+
+        // width of the member at start or 0, reachedEnd tells whether the sequence ran into the end of str
+
+        int match(const std::string& str, const int start, bool& reachedEnd) const;
+
+        // end of the run of at most maxCount members from start, count is how many it holds
+        // blocks of sixteen ASCII bytes are found with SSE2 and checked against the table without decoding
+
+        int matchRun(const std::string& str, const int start, const int maxCount, int& count, bool& reachedEnd) const;
+};
+
+#endif
@@ -0,0 +1,523 @@
+// generated by generate_unicode_tables.py from the Unicode 14.0.0 character database, do not edit
+
+#ifndef UNICODE_TABLES_HPP
+#define UNICODE_TABLES_HPP
+
+#include <cstdint>
+
+// 19168 bytes, a code point picks a row with its top bits, a block from the row with the next 5 bits and its category from the block with the low 4 bits
+
+const int unicodeBlockShift = 4;
+const int unicodeRowShift = 5;
+
+static const uint8_t unicodeCategoryRows[2176] = {
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,26,
+    26,26,26,26,26,26,27,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,28,26,29,30,31,32,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,33,34,34,34,34,35,35,35,35,35,35,35,35,35,35,35,35,36,37,38,39,
+    40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,26,56,57,58,58,58,58,59,26,26,60,58,58,58,58,58,
+    58,58,26,61,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,26,62,58,63,26,26,26,26,26,26,26,26,
+    26,26,26,64,26,26,65,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,66,67,68,58,58,58,58,69,58,
+    58,58,58,58,58,58,58,70,71,72,73,74,75,76,58,77,78,79,58,80,81,58,82,83,84,85,75,86,87,88,58,58,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,89,26,26,26,26,26,26,26,90,91,26,26,26,
+    26,26,26,26,26,26,26,92,26,26,26,26,26,26,26,26,26,26,26,26,26,93,58,58,58,58,58,58,26,94,58,58,
+    26,26,26,26,26,26,26,26,26,95,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    96,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,97,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+    35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,97
+};
+
+static const uint16_t unicodeCategoryBlockIndices[3136] = {
+    0,0,1,2,3,4,5,6,0,0,7,8,9,10,11,12,13,13,13,14,15,13,13,16,17,18,19,20,21,22,13,23,
+    13,13,13,24,25,11,11,11,11,26,11,27,28,29,30,31,32,32,32,32,32,32,32,33,34,35,36,11,37,38,13,39,
+    9,9,9,11,11,11,13,13,40,13,13,13,41,13,13,13,13,13,13,42,9,43,11,11,44,45,32,46,47,48,49,50,
+    51,52,48,48,53,32,54,55,48,48,48,48,48,56,57,58,59,60,48,32,61,48,48,48,48,48,62,63,64,48,65,66,
+    48,67,68,69,48,70,71,48,72,73,48,48,74,32,75,32,76,48,48,77,78,79,80,81,82,83,84,85,86,87,88,89,
+    90,83,84,91,92,93,94,95,96,97,84,98,99,100,88,101,102,83,84,103,104,105,88,106,107,108,109,110,111,112,94,113,
+    114,115,84,116,117,118,88,119,120,115,84,121,122,123,88,124,125,115,48,126,127,128,88,129,130,131,48,132,133,134,94,135,
+    136,48,48,137,138,139,140,140,141,48,142,143,144,145,140,140,146,147,148,149,150,48,151,152,153,154,32,155,156,157,140,140,
+    48,48,158,159,160,161,162,163,164,165,9,9,166,11,11,167,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,168,169,48,48,168,48,48,170,171,172,48,48,48,171,48,48,48,173,174,175,48,176,9,9,9,9,9,177,
+    178,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,179,48,180,181,48,48,48,48,182,183,48,184,48,185,48,186,187,188,48,48,48,189,190,191,192,193,
+    194,192,48,48,195,48,48,196,197,48,198,48,48,48,48,199,48,200,201,202,203,48,204,205,48,48,206,48,207,208,209,209,
+    48,210,48,48,48,211,212,213,192,192,214,215,216,140,140,140,217,48,48,218,219,160,220,221,222,48,223,64,48,48,224,225,
+    48,48,226,227,228,64,48,229,230,9,9,231,232,233,234,235,11,11,236,27,27,27,237,238,11,239,27,27,32,32,32,32,
+    13,13,13,13,13,13,13,13,13,240,13,13,13,13,13,13,241,242,241,241,242,243,241,244,245,245,245,246,247,248,249,250,
+    251,252,253,254,255,256,257,258,259,260,261,261,262,263,264,265,266,267,268,269,270,271,272,272,273,274,275,209,276,277,209,278,
+    279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,280,209,281,209,209,209,209,282,209,283,279,284,209,285,286,209,
+    209,209,287,140,288,140,271,271,271,289,209,209,209,209,290,271,209,209,209,209,209,209,209,209,209,209,209,291,292,209,209,293,
+    209,209,209,209,209,209,294,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,295,296,271,297,209,209,298,279,299,279,
+    209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,279,279,279,279,279,279,279,279,300,301,279,279,279,302,279,303,
+    279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,209,209,209,279,304,209,209,305,209,306,209,209,209,209,209,209,
+    9,9,9,11,11,11,307,308,13,13,13,13,13,13,309,310,11,11,311,48,48,48,312,313,48,314,315,315,315,315,32,32,
+    316,317,318,319,320,321,140,140,209,322,209,209,209,209,209,323,209,209,209,209,209,209,209,209,209,209,209,209,209,324,140,325,
+    326,327,328,329,136,48,48,48,48,330,178,48,48,48,48,331,332,48,48,136,48,48,48,48,200,333,48,48,209,209,323,48,
+    209,334,335,209,336,337,209,209,335,209,209,337,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,209,209,209,209,
+    48,338,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,151,209,209,209,287,48,48,229,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    339,48,340,140,13,13,341,342,13,343,48,48,48,48,344,345,31,346,347,348,13,13,13,349,350,351,352,353,354,355,140,356,
+    357,48,358,359,48,48,48,360,361,48,48,362,363,192,32,364,64,48,365,48,366,367,48,151,76,48,48,368,369,370,371,372,
+    48,48,373,374,375,376,48,377,48,48,48,378,379,380,381,382,383,384,315,11,11,385,386,11,11,11,11,11,48,48,387,192,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,388,48,389,48,48,206,
+    390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,
+    391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+    391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,204,48,48,48,48,48,48,207,140,140,392,393,394,395,396,48,48,48,48,48,48,397,398,399,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,400,209,48,48,48,48,401,48,48,402,140,140,403,
+    32,404,32,405,406,407,408,409,48,48,48,48,48,48,48,410,411,2,3,4,5,412,413,414,48,415,48,200,416,417,418,419,
+    420,48,172,421,204,204,140,140,48,48,48,48,48,48,48,71,422,271,271,423,272,272,272,424,425,426,427,140,140,209,209,428,
+    140,140,140,140,140,140,140,140,48,151,48,48,48,100,429,430,48,48,431,48,432,48,48,433,48,434,48,48,435,436,140,140,
+    9,9,437,11,11,48,48,48,48,204,192,9,9,438,11,439,48,48,440,48,48,48,441,442,442,443,444,445,140,140,140,140,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,314,48,199,440,140,446,27,27,447,140,140,140,140,
+    448,48,48,449,48,450,48,451,48,200,452,140,140,140,48,453,48,454,48,455,140,140,140,140,48,48,48,456,271,457,271,271,
+    458,459,48,460,461,462,48,463,48,464,140,140,465,48,466,467,48,48,48,468,48,469,48,470,48,471,472,140,140,140,140,140,
+    48,48,48,48,196,140,140,140,9,9,9,473,11,11,11,474,48,48,475,192,140,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,271,476,48,48,477,478,140,140,140,140,48,464,479,48,62,480,140,48,481,140,140,48,482,140,48,314,
+    483,48,48,484,485,457,486,487,222,48,48,488,489,48,196,192,490,48,491,492,493,48,48,494,222,48,48,495,496,497,498,499,
+    48,97,500,501,140,140,140,140,502,503,504,48,48,505,506,192,507,83,84,508,509,510,511,512,140,140,140,140,140,140,140,140,
+    48,48,48,513,514,515,478,140,48,48,48,516,517,192,140,140,140,140,140,140,140,140,140,140,48,48,518,519,520,521,140,140,
+    48,48,48,522,523,192,524,140,48,48,525,526,192,140,140,140,48,173,527,528,314,140,140,140,140,140,140,140,140,140,140,140,
+    48,48,500,529,140,140,140,140,140,140,9,9,11,11,148,530,531,532,48,533,534,192,140,140,140,140,535,48,48,536,537,140,
+    538,48,48,539,540,541,48,48,542,543,544,48,48,48,48,196,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    84,48,518,545,546,148,175,547,48,548,549,550,140,140,140,140,551,48,48,552,553,192,554,48,555,556,192,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,140,140,140,140,140,48,557,140,140,140,140,140,140,140,140,140,140,140,100,271,558,559,560,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,207,140,140,140,140,140,140,
+    272,272,272,272,272,272,561,562,48,48,48,48,48,48,48,48,48,48,48,48,388,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,48,48,48,48,48,48,563,
+    48,48,200,564,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    48,48,48,48,314,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    48,48,48,196,48,200,370,48,48,48,48,200,192,48,204,565,48,48,48,566,567,568,569,570,48,140,140,140,140,140,140,140,
+    140,140,140,140,9,9,11,11,271,571,140,140,140,140,140,140,48,48,48,48,572,573,574,574,575,576,140,140,140,140,577,578,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,440,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,199,140,140,196,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,579,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,580,140,140,580,581,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,206,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    48,48,48,48,48,48,71,151,196,582,583,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,32,32,584,32,585,209,209,209,209,209,209,209,323,140,140,140,
+    209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,324,209,209,586,209,209,209,587,588,589,209,590,209,209,209,288,140,
+    209,209,209,209,591,140,140,140,140,140,140,140,140,140,271,592,209,209,209,209,209,287,271,461,140,140,140,140,140,140,140,140,
+    9,593,11,594,595,596,241,9,597,598,599,600,601,9,593,11,602,603,11,604,605,606,607,9,608,11,9,593,11,594,595,11,
+    241,9,597,607,9,608,11,9,593,11,609,9,610,611,612,613,11,614,9,615,616,617,618,11,619,9,620,11,621,622,622,622,
+    209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+    32,32,32,623,32,32,624,625,626,627,45,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,628,629,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    630,631,632,140,140,140,140,140,140,140,140,140,140,140,140,140,48,48,151,633,634,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,48,635,140,48,48,636,637,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,638,200,
+    48,48,48,48,48,48,48,48,48,48,48,48,639,585,140,140,9,9,597,11,640,370,140,140,140,140,140,140,140,140,140,140,
+    140,140,140,140,140,140,140,498,271,271,641,642,140,140,140,140,498,271,643,644,140,140,140,140,140,140,140,140,140,140,140,140,
+    645,48,646,647,648,649,650,651,652,206,653,206,140,140,140,654,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    209,209,325,209,209,209,209,209,209,323,334,655,655,655,209,324,656,209,209,209,209,209,209,209,209,209,657,140,140,140,658,209,
+    659,209,209,325,660,661,324,140,140,140,140,140,140,140,140,140,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,662,
+    209,209,209,209,209,209,209,209,209,209,209,209,209,663,426,426,209,209,209,209,209,209,209,323,209,209,209,209,209,660,325,427,
+    325,209,209,209,664,176,209,209,664,209,657,661,140,140,140,140,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+    209,209,209,209,209,323,657,665,287,209,426,288,324,176,664,287,209,209,209,209,209,209,209,209,209,666,209,209,288,140,140,192,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,140,140,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,196,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,204,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,478,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,100,140,
+    48,204,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,71,140,140,140,140,140,140,140,140,140,140,140,
+    667,140,668,668,668,668,668,668,140,140,140,140,140,140,140,140,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,140,
+    391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,669
+};
+
+static const uint8_t unicodeCategoryBlocks[10720] = {
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,22,17,17,17,19,17,17,17,13,14,17,18,17,12,17,17,
+    8,8,8,8,8,8,8,8,8,8,17,17,18,18,18,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,13,17,14,20,11,20,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,13,18,14,18,25,22,17,19,19,19,19,21,17,20,21,4,15,18,26,21,20,
+    21,18,10,10,20,1,17,17,20,10,4,16,10,10,10,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,18,1,1,1,1,1,1,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+    0,1,0,1,0,1,0,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,1,0,1,0,1,
+    0,1,0,1,0,1,0,1,0,0,1,0,1,0,1,1,1,0,0,1,0,1,0,0,1,0,0,0,1,1,0,0,
+    0,0,1,0,0,1,0,0,0,1,1,1,0,0,1,0,0,1,0,1,0,1,0,0,1,0,1,1,0,1,0,0,
+    1,0,0,0,1,0,1,0,0,1,1,4,0,1,1,1,4,4,4,4,0,2,1,0,2,1,0,2,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,1,1,0,2,1,0,1,0,0,0,1,0,1,0,1,0,1,
+    0,1,0,1,1,1,1,1,1,1,0,0,1,0,0,1,1,0,1,0,0,0,0,1,0,1,0,1,0,1,0,1,
+    1,1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    3,3,20,20,20,20,3,3,3,3,3,3,3,3,3,3,3,3,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+    3,3,3,3,3,20,20,20,20,20,20,20,3,20,3,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,1,0,1,3,20,0,1,29,29,3,1,1,1,17,0,
+    29,29,29,29,20,20,0,17,0,0,0,29,0,29,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,29,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+    1,1,0,0,0,1,1,1,0,1,0,1,0,1,0,1,1,1,1,1,0,1,18,0,1,0,0,1,1,0,0,0,
+    0,1,21,5,5,5,5,5,7,7,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,
+    29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,29,3,17,17,17,17,17,17,
+    1,1,1,1,1,1,1,1,1,17,12,29,29,21,21,19,29,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,5,17,5,5,17,5,5,17,5,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,29,29,29,4,
+    4,4,4,17,17,29,29,29,29,29,29,29,29,29,29,29,26,26,26,26,26,26,18,18,18,17,17,19,17,17,21,21,
+    5,5,5,5,5,5,5,5,5,5,5,17,26,17,17,17,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,
+    8,8,8,8,8,8,8,8,8,8,17,17,17,17,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,17,4,5,5,5,5,5,5,5,26,21,5,5,5,5,5,5,3,3,5,5,21,5,5,5,5,4,4,
+    8,8,8,8,8,8,8,8,8,8,4,4,4,21,21,4,17,17,17,17,17,17,17,17,17,17,17,17,17,17,29,26,
+    4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,29,29,4,4,4,
+    4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,4,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,
+    5,5,5,5,3,3,21,17,17,17,3,29,29,5,19,19,4,4,4,4,4,4,5,5,5,5,3,5,5,5,5,5,
+    5,5,5,5,3,5,5,5,3,5,5,5,5,5,29,29,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,29,
+    4,4,4,4,4,4,4,4,4,5,5,5,29,29,17,29,4,4,4,4,4,4,4,4,4,4,4,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,20,4,4,4,4,4,4,29,26,26,29,29,29,29,29,29,5,5,5,5,5,5,5,5,
+    4,4,4,4,4,4,4,4,4,3,5,5,5,5,5,5,5,5,26,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,6,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,6,5,4,6,6,
+    6,5,5,5,5,5,5,5,5,6,6,6,6,5,6,6,4,5,5,5,5,5,5,5,4,4,4,4,4,4,4,4,
+    4,4,5,5,17,17,8,8,8,8,8,8,8,8,8,8,17,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,5,6,6,29,4,4,4,4,4,4,4,4,29,29,4,4,29,29,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,29,4,4,4,4,4,4,4,29,4,29,29,29,4,4,4,4,29,29,5,4,6,6,
+    6,5,5,5,5,29,29,6,6,29,29,6,6,5,4,29,29,29,29,29,29,29,29,6,29,29,29,29,4,4,29,4,
+    4,4,5,5,29,29,8,8,8,8,8,8,8,8,8,8,4,4,19,19,10,10,10,10,10,10,21,19,4,17,5,29,
+    29,5,5,6,29,4,4,4,4,4,4,29,29,29,29,4,4,29,4,4,29,4,4,29,4,4,29,29,5,29,6,6,
+    6,5,5,29,29,29,29,5,5,29,29,5,5,5,29,29,29,5,29,29,29,29,29,29,29,4,4,4,4,29,4,29,
+    29,29,29,29,29,29,8,8,8,8,8,8,8,8,8,8,5,5,4,4,4,5,17,29,29,29,29,29,29,29,29,29,
+    29,5,5,6,29,4,4,4,4,4,4,4,4,4,29,4,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,29,4,4,29,4,4,4,4,4,29,29,5,4,6,6,6,5,5,5,5,5,29,5,5,6,29,6,6,5,29,29,
+    4,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,17,19,29,29,29,29,29,29,29,4,5,5,5,5,5,5,
+    29,5,6,6,29,4,4,4,4,4,4,4,4,29,29,4,4,29,4,4,29,4,4,4,4,4,29,29,5,4,6,5,
+    6,5,5,5,5,29,29,6,6,29,29,6,6,5,29,29,29,29,29,29,29,5,5,6,29,29,29,29,4,4,29,4,
+    21,4,10,10,10,10,10,10,29,29,29,29,29,29,29,29,29,29,5,4,29,4,4,4,4,4,4,29,29,29,4,4,
+    4,29,4,4,4,4,29,29,29,4,4,29,4,29,4,4,29,29,29,4,4,29,29,29,4,4,4,29,29,29,4,4,
+    4,4,4,4,4,4,4,4,4,4,29,29,29,29,6,6,5,6,6,29,29,29,6,6,6,29,6,6,6,5,29,29,
+    4,29,29,29,29,29,29,6,29,29,29,29,29,29,29,29,10,10,10,21,21,21,21,21,21,19,21,29,29,29,29,29,
+    5,6,6,6,5,4,4,4,4,4,4,4,4,29,4,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,29,29,5,4,5,5,5,6,6,6,6,29,5,5,5,29,5,5,5,5,29,29,
+    29,29,29,29,29,5,5,29,4,4,4,29,29,4,29,29,29,29,29,29,29,29,29,17,10,10,10,10,10,10,10,21,
+    4,5,6,6,17,4,4,4,4,4,4,4,4,29,4,4,4,4,4,4,29,4,4,4,4,4,29,29,5,4,6,5,
+    6,6,6,6,6,29,5,6,6,29,6,6,5,5,29,29,29,29,29,29,29,6,6,29,29,29,29,29,29,4,4,29,
+    29,4,4,29,29,29,29,29,29,29,29,29,29,29,29,29,5,5,6,6,4,4,4,4,4,4,4,4,4,29,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,5,5,4,6,6,6,5,5,5,5,29,6,6,6,29,6,6,6,5,4,21,
+    29,29,29,29,4,4,4,6,10,10,10,10,10,10,10,4,10,10,10,10,10,10,10,10,10,21,4,4,4,4,4,4,
+    29,5,6,6,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,29,29,4,4,4,4,4,4,
+    4,4,29,4,4,4,4,4,4,4,4,4,29,4,29,29,4,4,4,4,4,4,4,29,29,29,5,29,29,29,29,6,
+    6,6,5,5,5,29,5,29,6,6,6,6,6,6,6,6,29,29,6,6,17,29,29,29,29,29,29,29,29,29,29,29,
+    29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,5,5,5,5,5,5,5,29,29,29,29,19,
+    4,4,4,4,4,4,3,5,5,5,5,5,5,5,5,17,8,8,8,8,8,8,8,8,8,8,17,17,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,4,4,29,4,29,4,4,4,4,4,29,4,4,4,4,
+    4,4,4,4,29,4,29,4,4,4,4,4,4,4,4,4,4,5,4,4,5,5,5,5,5,5,5,5,5,4,29,29,
+    4,4,4,4,4,29,3,29,5,5,5,5,5,5,29,29,8,8,8,8,8,8,8,8,8,8,29,29,4,4,4,4,
+    4,21,21,21,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,21,17,21,21,21,5,5,21,21,21,21,21,21,
+    8,8,8,8,8,8,8,8,8,8,10,10,10,10,10,10,10,10,10,10,21,5,21,5,21,5,13,14,13,14,6,6,
+    4,4,4,4,4,4,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,29,29,
+    29,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,5,5,5,5,5,17,5,5,4,4,4,4,4,5,5,5,
+    5,5,5,5,5,5,5,5,29,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,21,21,
+    21,21,21,21,21,21,5,21,21,21,21,21,21,29,21,21,17,17,17,17,17,21,21,21,21,17,17,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,6,6,5,5,5,5,6,5,5,5,5,5,5,6,5,5,6,6,5,5,4,
+    8,8,8,8,8,8,8,8,8,8,17,17,17,17,17,17,4,4,4,4,4,4,6,6,5,5,4,4,4,4,5,5,
+    5,4,6,6,6,4,4,6,6,6,6,6,6,6,4,4,4,5,5,5,5,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,5,6,6,5,5,6,6,6,6,6,6,5,4,6,8,8,8,8,8,8,8,8,8,8,6,6,6,5,21,21,
+    0,0,0,0,0,0,29,0,29,29,29,29,29,0,29,29,1,1,1,1,1,1,1,1,1,1,1,17,3,1,1,1,
+    4,4,4,4,4,4,4,4,4,29,4,4,4,4,29,29,4,4,4,4,4,4,4,29,4,29,4,4,4,4,29,29,
+    4,29,4,4,4,4,29,29,4,4,4,4,4,4,4,29,4,29,4,4,4,4,29,29,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,29,5,5,5,
+    17,17,17,17,17,17,17,17,17,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,29,29,29,
+    21,21,21,21,21,21,21,21,21,21,29,29,29,29,29,29,0,0,0,0,0,0,29,29,1,1,1,1,1,1,29,29,
+    12,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,21,17,4,
+    22,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,13,14,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,17,17,17,9,9,9,4,4,4,4,4,4,4,4,29,29,29,29,29,29,29,
+    4,4,5,5,5,6,29,29,29,29,29,29,29,29,29,4,4,4,5,5,6,17,17,29,29,29,29,29,29,29,29,29,
+    4,4,5,5,29,29,29,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,4,4,4,4,4,4,4,29,4,4,
+    4,29,5,5,29,29,29,29,29,29,29,29,29,29,29,29,4,4,4,4,5,5,6,5,5,5,5,5,5,5,6,6,
+    6,6,6,6,6,6,5,6,6,5,5,5,5,5,5,5,5,5,5,5,17,17,17,3,17,17,17,19,4,5,29,29,
+    8,8,8,8,8,8,8,8,8,8,29,29,29,29,29,29,10,10,10,10,10,10,10,10,10,10,29,29,29,29,29,29,
+    17,17,17,17,17,17,12,17,17,17,17,5,5,5,26,5,4,4,4,3,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,29,29,29,29,29,29,29,4,4,4,4,4,5,5,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,5,4,29,29,29,29,29,4,4,4,4,4,4,29,29,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,5,5,5,6,6,6,6,5,5,6,6,6,29,29,29,29,
+    6,6,5,6,6,6,6,6,6,5,5,5,29,29,29,29,21,29,29,29,17,17,8,8,8,8,8,8,8,8,8,8,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,29,4,4,4,4,4,29,29,29,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,29,29,29,29,4,4,4,4,4,4,4,4,4,4,29,29,29,29,29,29,
+    8,8,8,8,8,8,8,8,8,8,10,29,29,29,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    4,4,4,4,4,4,4,5,5,6,6,5,29,29,17,17,4,4,4,4,4,6,5,6,5,5,5,5,5,5,5,29,
+    5,6,5,6,6,5,5,5,5,5,5,5,5,6,6,6,6,6,6,5,5,5,5,5,5,5,5,5,5,29,29,5,
+    17,17,17,17,17,17,17,3,17,17,17,17,17,17,29,29,5,5,5,5,5,5,5,5,5,5,5,5,5,5,7,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,5,5,5,5,6,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,5,6,5,5,5,5,5,6,5,6,6,6,6,6,5,6,6,4,4,4,4,4,4,4,4,29,29,29,
+    17,21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,5,5,5,21,21,21,21,21,21,21,21,21,17,17,29,
+    5,5,6,4,4,4,4,4,4,4,4,4,4,4,4,4,4,6,5,5,5,5,6,6,5,5,6,5,5,5,4,4,
+    4,4,4,4,4,4,5,6,5,5,6,6,6,5,6,5,5,5,6,6,29,29,29,29,29,29,29,29,17,17,17,17,
+    4,4,4,4,6,6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,6,6,5,5,29,29,29,17,17,17,17,17,
+    8,8,8,8,8,8,8,8,8,8,29,29,29,4,4,4,4,4,4,4,4,4,4,4,3,3,3,3,3,3,17,17,
+    1,1,1,1,1,1,1,1,1,29,29,29,29,29,29,29,0,0,0,0,0,0,0,0,0,0,0,29,29,0,0,0,
+    17,17,17,17,17,17,17,17,29,29,29,29,29,29,29,29,5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,6,5,5,5,5,5,5,5,4,4,4,4,5,4,4,4,4,4,4,5,4,4,6,5,5,4,29,29,29,29,29,
+    1,1,1,1,1,1,1,1,1,1,1,1,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,3,3,3,3,
+    0,1,0,1,0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+    1,1,1,1,1,1,29,29,0,0,0,0,0,0,29,29,1,1,1,1,1,1,1,1,29,0,29,0,29,0,29,0,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,29,29,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,29,1,1,0,0,0,0,2,20,1,20,20,20,1,1,1,29,1,1,0,0,0,0,2,20,20,20,
+    1,1,1,1,29,29,1,1,0,0,0,0,29,20,20,20,1,1,1,1,1,1,1,1,0,0,0,0,0,20,20,20,
+    29,29,1,1,1,29,1,1,0,0,0,0,2,20,20,29,22,22,22,22,22,22,22,22,22,22,22,26,26,26,26,26,
+    12,12,12,12,12,12,17,17,15,16,13,15,15,16,13,15,17,17,17,17,17,17,17,17,23,24,26,26,26,26,26,22,
+    17,17,17,17,17,17,17,17,17,15,16,17,17,17,17,11,11,17,17,17,18,13,14,17,17,17,17,17,17,17,17,17,
+    17,17,18,17,11,17,17,17,17,17,17,17,17,17,17,22,26,26,26,26,26,29,26,26,26,26,26,26,26,26,26,26,
+    10,3,29,29,10,10,10,10,10,10,18,18,18,13,14,3,10,10,10,10,10,10,10,10,10,10,18,18,18,13,14,29,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,29,29,29,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+    19,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,5,5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,
+    7,5,7,7,7,5,5,5,5,5,5,5,5,5,5,5,5,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    21,21,0,21,21,21,21,0,21,21,1,0,0,0,1,1,0,0,0,1,21,0,21,21,18,0,0,0,0,0,21,21,
+    21,21,21,21,0,21,0,21,0,21,0,0,0,0,21,1,0,0,0,0,1,4,4,4,4,1,21,21,1,1,0,0,
+    18,18,18,18,18,0,1,1,1,1,21,18,21,21,1,21,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,0,1,9,9,9,9,10,21,21,29,29,29,29,
+    18,18,18,18,18,21,21,21,21,21,18,18,21,21,21,21,18,21,21,18,21,21,18,21,21,21,21,21,21,21,18,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,18,18,21,21,18,21,18,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    21,21,21,21,21,21,21,21,13,14,13,14,21,21,21,21,18,18,21,21,21,21,21,21,21,13,14,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,18,21,21,21,21,21,21,21,21,21,21,21,21,21,21,18,18,18,18,18,
+    18,18,18,18,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,18,18,18,18,
+    18,18,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,29,29,29,29,29,29,29,29,29,
+    21,21,21,21,21,21,21,21,21,21,21,29,29,29,29,29,10,10,10,10,10,10,10,10,10,10,10,10,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,10,10,10,10,10,10,21,21,21,21,21,21,21,18,21,21,21,21,21,21,21,21,
+    21,18,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,18,18,18,18,18,18,18,18,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,18,21,21,21,21,21,21,21,21,13,14,13,14,13,14,13,14,
+    13,14,13,14,13,14,10,10,10,10,10,10,10,10,10,10,10,10,10,10,21,21,21,21,21,21,21,21,21,21,21,21,
+    18,18,18,18,18,13,14,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,13,14,13,14,13,14,13,14,13,14,
+    18,18,18,13,14,13,14,13,14,13,14,13,14,13,14,13,14,13,14,13,14,13,14,13,14,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,13,14,13,14,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,13,14,18,18,
+    18,18,18,18,18,21,21,18,18,18,18,18,18,21,21,21,21,21,21,21,29,29,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,29,21,21,21,21,21,21,21,21,21,0,1,0,0,0,1,1,0,1,0,1,0,1,0,0,0,
+    0,1,0,1,1,0,1,1,1,1,1,1,3,3,0,0,0,1,0,1,1,21,21,21,21,21,21,0,1,0,1,5,
+    5,5,0,1,29,29,29,29,29,17,17,17,17,10,17,17,1,1,1,1,1,1,29,1,29,29,29,29,29,1,29,29,
+    4,4,4,4,4,4,4,4,29,29,29,29,29,29,29,3,17,29,29,29,29,29,29,29,29,29,29,29,29,29,29,5,
+    4,4,4,4,4,4,4,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,4,29,4,4,4,4,4,4,4,29,
+    17,17,15,16,15,16,17,17,17,15,16,17,15,16,17,17,17,17,17,17,17,17,17,12,17,17,12,17,15,16,17,17,
+    15,16,13,14,13,14,13,14,13,14,17,17,17,17,17,3,17,17,17,17,17,17,17,17,17,17,12,12,17,17,17,17,
+    12,17,13,17,17,17,17,17,17,17,17,17,17,17,17,17,21,21,17,17,17,13,14,13,14,13,14,13,14,12,29,29,
+    21,21,21,21,21,21,21,21,21,21,29,21,21,21,21,21,21,21,21,21,29,29,29,29,29,29,29,29,29,29,29,29,
+    21,21,21,21,21,21,29,29,29,29,29,29,29,29,29,29,21,21,21,21,21,21,21,21,21,21,21,21,29,29,29,29,
+    22,17,17,17,21,3,4,9,13,14,13,14,13,14,13,14,13,14,21,21,13,14,13,14,13,14,13,14,12,13,14,14,
+    21,9,9,9,9,9,9,9,9,9,5,5,5,5,6,6,12,3,3,3,3,3,21,21,9,9,9,3,4,17,21,21,
+    4,4,4,4,4,4,4,29,29,5,5,20,20,3,3,4,4,4,4,4,4,4,4,4,4,4,4,17,3,3,3,4,
+    29,29,29,29,29,4,4,4,4,4,4,4,4,4,4,4,21,21,10,10,10,10,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,29,10,10,10,10,10,10,10,10,10,10,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,10,10,10,10,10,10,10,10,21,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    4,4,4,4,4,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,3,17,17,17,
+    8,8,8,8,8,8,8,8,8,8,4,4,29,29,29,29,0,1,0,1,0,1,0,1,0,1,0,1,0,1,4,5,
+    7,7,7,17,5,5,5,5,5,5,5,5,5,5,17,3,0,1,0,1,0,1,0,1,0,1,0,1,3,3,5,5,
+    4,4,4,4,4,4,9,9,9,9,9,9,9,9,9,9,5,5,17,17,17,17,17,17,29,29,29,29,29,29,29,29,
+    20,20,20,20,20,20,20,3,3,3,3,3,3,3,3,3,20,20,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+    1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,3,1,1,1,1,1,1,1,1,0,1,0,1,0,0,1,
+    0,1,0,1,0,1,0,1,3,20,20,0,1,0,1,4,0,1,0,1,1,1,0,1,0,1,0,1,0,1,0,1,
+    0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,
+    0,1,0,1,0,0,0,0,1,0,1,29,29,29,29,29,0,1,29,1,29,1,0,1,0,1,29,29,29,29,29,29,
+    29,29,3,3,3,0,1,4,3,3,1,4,4,4,4,4,4,4,5,4,4,4,5,4,4,4,4,5,4,4,4,4,
+    4,4,4,6,6,5,5,6,21,21,21,21,5,29,29,29,10,10,10,10,10,10,21,21,19,21,29,29,29,29,29,29,
+    4,4,4,4,17,17,17,17,29,29,29,29,29,29,29,29,6,6,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,5,5,29,29,29,29,29,29,29,29,17,17,
+    5,5,4,4,4,4,4,4,17,17,17,4,17,4,4,5,4,4,4,4,4,4,5,5,5,5,5,5,5,5,17,17,
+    4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,6,6,29,29,29,29,29,29,29,29,29,29,29,17,
+    4,4,4,5,6,6,5,5,5,5,6,6,5,5,6,6,6,17,17,17,17,17,17,17,17,17,17,17,17,17,29,3,
+    8,8,8,8,8,8,8,8,8,8,29,29,29,29,17,17,4,4,4,4,4,5,3,4,4,4,4,4,4,4,4,4,
+    8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,29,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,
+    6,5,5,6,6,5,5,29,29,29,29,29,29,29,29,29,4,4,4,5,4,4,4,4,4,4,4,4,5,6,29,29,
+    8,8,8,8,8,8,8,8,8,8,29,29,17,17,17,17,3,4,4,4,4,4,4,21,21,21,4,6,5,6,4,4,
+    5,4,5,5,5,4,4,5,5,4,4,4,4,4,5,5,4,5,4,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,4,4,3,17,17,4,4,4,4,4,4,4,4,4,4,4,6,5,5,6,6,
+    17,17,4,3,3,6,5,29,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,29,29,4,4,4,4,4,4,29,
+    29,4,4,4,4,4,4,29,29,29,29,29,29,29,29,29,1,1,1,1,1,1,1,1,1,1,1,20,3,3,3,3,
+    1,1,1,1,1,1,1,1,1,3,20,20,29,29,29,29,4,4,4,6,6,5,6,6,5,6,6,17,6,5,29,29,
+    4,4,4,4,29,29,29,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,4,29,29,29,29,4,4,4,4,4,
+    27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+    1,1,1,1,1,1,1,29,29,29,29,29,29,29,29,29,29,29,29,1,1,1,1,1,29,29,29,29,29,4,5,4,
+    4,4,4,4,4,4,4,4,4,18,4,4,4,4,4,4,4,4,4,4,4,4,4,29,4,4,4,4,4,29,4,29,
+    4,4,29,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+    20,20,20,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,14,13,29,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,29,29,29,29,29,29,29,21,4,4,4,4,4,4,4,4,4,4,4,4,19,21,21,21,
+    17,17,17,17,17,17,17,13,14,17,29,29,29,29,29,29,17,12,12,11,11,13,14,13,14,13,14,13,14,13,14,13,
+    14,13,14,13,14,17,17,13,14,17,17,17,17,11,11,11,17,17,17,29,17,17,17,17,12,13,14,13,14,13,14,17,
+    17,17,18,12,18,18,18,29,17,19,17,17,29,29,29,29,4,4,4,4,4,29,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,29,29,26,29,17,17,17,19,17,17,17,13,14,17,18,17,12,17,17,
+    1,1,1,1,1,1,1,1,1,1,1,13,18,14,18,13,14,17,13,14,17,17,4,4,4,4,4,4,4,4,4,4,
+    3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,3,3,
+    29,29,4,4,4,4,4,4,29,29,4,4,4,4,4,4,29,29,4,4,4,4,4,4,29,29,4,4,4,29,29,29,
+    19,19,18,20,21,19,19,29,21,18,18,18,18,21,21,29,29,29,29,29,29,29,29,29,29,26,26,26,21,21,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,4,4,29,4,
+    17,17,17,29,29,29,29,10,10,10,10,10,10,10,10,10,10,10,10,10,29,29,29,21,21,21,21,21,21,21,21,21,
+    9,9,9,9,9,10,10,10,10,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,10,10,21,21,21,29,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,29,29,29,21,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,5,29,29,5,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,29,29,29,29,10,10,10,10,29,29,29,29,29,29,29,29,29,4,4,4,
+    4,9,4,4,4,4,4,4,4,4,9,29,29,29,29,29,4,4,4,4,4,4,5,5,5,5,5,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,17,4,4,4,4,29,29,29,29,4,4,4,4,4,4,4,4,
+    17,9,9,9,9,9,29,29,29,29,29,29,29,29,29,29,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+    0,0,0,0,29,29,29,29,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,29,29,29,29,
+    4,4,4,4,4,4,4,4,29,29,29,29,29,29,29,29,4,4,4,4,29,29,29,29,29,29,29,29,29,29,29,17,
+    0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,29,0,0,29,1,1,1,1,1,1,1,1,1,
+    1,1,29,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,29,1,1,1,1,1,1,1,29,1,1,29,29,29,
+    3,3,3,3,3,3,29,3,3,3,3,3,3,3,3,3,3,29,3,3,3,3,3,3,3,3,3,29,29,29,29,29,
+    4,4,4,4,4,4,29,29,4,29,4,4,4,4,4,4,4,4,4,4,4,4,29,4,4,29,29,29,4,29,29,4,
+    4,4,4,4,4,4,29,17,10,10,10,10,10,10,10,10,4,4,4,4,4,4,4,21,21,10,10,10,10,10,10,10,
+    29,29,29,29,29,29,29,10,10,10,10,10,10,10,10,10,4,4,4,29,4,4,29,29,29,29,29,10,10,10,10,10,
+    4,4,4,4,4,4,10,10,10,10,10,10,29,29,29,17,4,4,4,4,4,4,4,4,4,4,29,29,29,29,29,17,
+    4,4,4,4,4,4,4,4,29,29,29,29,10,10,4,4,29,29,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    4,5,5,5,29,5,5,29,29,29,29,29,5,5,5,5,4,4,4,4,29,4,4,4,29,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,29,29,5,5,5,29,29,29,29,5,10,10,10,10,10,10,10,10,10,29,29,29,29,29,29,29,
+    17,17,17,17,17,17,17,17,17,29,29,29,29,29,29,29,4,4,4,4,4,4,4,4,4,4,4,4,4,10,10,17,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,10,10,10,4,4,4,4,4,4,4,4,21,4,4,4,4,4,4,4,
+    4,4,4,4,4,5,5,29,29,29,29,10,10,10,10,10,17,17,17,17,17,17,17,29,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,29,29,29,17,17,17,17,17,17,17,4,4,4,4,4,4,29,29,10,10,10,10,10,10,10,10,
+    4,4,4,29,29,29,29,29,10,10,10,10,10,10,10,10,4,4,29,29,29,29,29,29,29,17,17,17,17,29,29,29,
+    29,29,29,29,29,29,29,29,29,10,10,10,10,10,10,10,0,0,0,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    1,1,1,29,29,29,29,29,29,29,10,10,10,10,10,10,4,4,4,4,5,5,5,5,29,29,29,29,29,29,29,29,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,29,4,4,4,4,4,4,4,4,4,4,29,5,5,12,29,29,
+    4,4,29,29,29,29,29,29,29,29,29,29,29,29,29,29,10,10,10,10,10,10,10,4,29,29,29,29,29,29,29,29,
+    5,10,10,10,10,17,17,17,17,17,29,29,29,29,29,29,4,4,5,5,5,5,17,17,17,17,29,29,29,29,29,29,
+    4,4,4,4,4,10,10,10,10,10,10,10,29,29,29,29,6,5,6,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,17,17,17,17,17,17,29,29,
+    10,10,10,10,10,10,8,8,8,8,8,8,8,8,8,8,5,4,4,5,5,4,29,29,29,29,29,29,29,29,29,5,
+    6,6,6,5,5,5,5,6,6,5,5,17,17,26,17,17,17,17,5,29,29,29,29,29,29,29,29,29,29,26,29,29,
+    5,5,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,6,5,5,5,
+    5,5,5,5,5,29,8,8,8,8,8,8,8,8,8,8,17,17,17,17,4,6,6,4,29,29,29,29,29,29,29,29,
+    4,4,4,5,17,17,4,29,29,29,29,29,29,29,29,29,4,4,4,6,6,6,5,5,5,5,5,5,5,5,5,6,
+    6,4,4,4,4,17,17,17,17,5,5,5,5,17,6,5,8,8,8,8,8,8,8,8,8,8,4,17,4,17,17,17,
+    29,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,29,29,29,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,6,6,6,5,5,5,6,6,5,6,5,5,17,17,17,17,17,17,5,29,
+    4,4,4,4,4,4,4,29,4,29,4,4,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,29,4,
+    4,4,4,4,4,4,4,4,4,17,29,29,29,29,29,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,
+    6,6,6,5,5,5,5,5,5,5,5,29,29,29,29,29,5,5,6,6,29,4,4,4,4,4,4,4,4,29,29,4,
+    4,29,4,4,29,4,4,4,4,4,29,5,5,4,6,6,5,6,6,6,6,29,29,6,6,29,29,6,6,6,29,29,
+    4,29,29,29,29,29,29,6,29,29,29,29,29,4,4,4,4,4,6,6,29,29,5,5,5,5,5,5,5,29,29,29,
+    5,5,5,5,5,29,29,29,29,29,29,29,29,29,29,29,4,4,4,4,4,6,6,6,5,5,5,5,5,5,5,5,
+    6,6,5,5,5,6,5,4,4,4,4,17,17,17,17,17,8,8,8,8,8,8,8,8,8,8,17,17,29,17,5,4,
+    6,6,6,5,5,5,5,5,5,6,5,6,6,6,6,5,5,6,5,5,4,4,17,4,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,6,6,6,5,5,5,5,29,29,6,6,6,6,5,5,6,5,
+    5,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4,4,4,4,5,5,29,29,
+    6,6,6,5,5,5,5,5,5,5,5,6,6,5,6,5,5,17,17,17,4,29,29,29,29,29,29,29,29,29,29,29,
+    17,17,17,17,17,17,17,17,17,17,17,17,17,29,29,29,4,4,4,4,4,4,4,4,4,4,4,5,6,5,6,6,
+    5,5,5,5,5,5,6,5,4,17,29,29,29,29,29,29,6,6,5,5,5,5,6,5,5,5,5,5,29,29,29,29,
+    8,8,8,8,8,8,8,8,8,8,10,10,17,17,17,21,5,5,5,5,5,5,5,5,6,5,5,17,29,29,29,29,
+    10,10,10,29,29,29,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,4,4,29,29,4,29,29,4,4,4,4,
+    4,4,4,4,29,4,4,29,4,4,4,4,4,4,4,4,6,6,6,6,6,6,29,6,6,29,29,5,5,6,5,4,
+    6,4,6,5,17,17,17,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,4,4,29,29,4,4,4,4,4,4,
+    4,6,6,6,5,5,5,5,29,29,5,5,6,6,6,6,5,4,17,4,6,29,29,29,29,29,29,29,29,29,29,29,
+    4,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,4,5,5,5,5,17,
+    17,17,17,17,17,17,17,5,29,29,29,29,29,29,29,29,4,5,5,5,5,5,5,6,6,5,5,5,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,6,5,5,17,17,17,4,17,17,
+    17,17,17,29,29,29,29,29,29,29,29,29,29,29,29,29,5,5,5,5,5,5,5,29,5,5,5,5,5,5,6,5,
+    4,17,17,17,17,17,29,29,29,29,29,29,29,29,29,29,17,17,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    29,29,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,6,5,5,5,5,5,5,
+    5,6,5,5,6,5,5,29,29,29,29,29,29,29,29,29,4,4,4,4,4,4,4,29,4,4,29,4,4,4,4,4,
+    4,5,5,5,5,5,5,29,29,29,5,29,5,5,29,5,5,5,5,5,5,5,4,5,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,29,4,4,29,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,6,6,6,6,6,29,
+    5,5,29,6,6,5,6,5,4,29,29,29,29,29,29,29,4,4,4,5,5,6,6,17,17,29,29,29,29,29,29,29,
+    10,10,10,10,10,21,21,21,21,21,21,21,21,19,19,19,19,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,29,29,29,29,29,29,29,29,29,29,29,29,29,17,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,29,
+    17,17,17,17,17,29,29,29,29,29,29,29,29,29,29,29,4,17,17,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    26,26,26,26,26,26,26,26,26,29,29,29,29,29,29,29,5,5,5,5,5,17,29,29,29,29,29,29,29,29,29,29,
+    5,5,5,5,5,5,5,17,17,17,17,17,21,21,21,21,3,3,3,3,17,21,29,29,29,29,29,29,29,29,29,29,
+    8,8,8,8,8,8,8,8,8,8,29,10,10,10,10,10,10,10,29,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,29,29,29,29,29,4,4,4,10,10,10,10,10,10,10,17,17,17,17,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,4,29,29,29,29,5,4,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+    6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,29,29,29,29,29,29,29,5,
+    5,5,5,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,17,3,5,29,29,29,29,29,29,29,29,29,29,29,
+    6,6,29,29,29,29,29,29,29,29,29,29,29,29,29,29,3,3,3,3,29,3,3,3,3,3,3,3,29,3,3,29,
+    4,4,4,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,4,4,4,4,29,29,29,29,29,29,29,29,
+    4,4,4,4,4,4,4,4,4,4,29,29,21,5,5,17,26,26,26,26,29,29,29,29,29,29,29,29,29,29,29,29,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,29,5,5,5,5,5,5,5,29,29,29,29,29,29,29,29,29,
+    21,21,21,21,21,21,21,29,29,21,21,21,21,21,21,21,21,21,21,21,21,6,6,5,5,5,21,21,21,6,6,6,
+    6,6,6,26,26,26,26,26,26,26,26,5,5,5,5,5,5,5,5,21,21,5,5,5,5,5,5,5,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,5,5,5,5,21,21,21,21,5,5,5,21,29,29,29,29,29,29,29,29,29,29,
+    10,10,10,10,29,29,29,29,29,29,29,29,29,29,29,29,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
+    1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+    1,1,1,1,1,29,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,0,29,0,0,29,29,0,29,29,0,0,29,29,0,0,0,0,29,0,0,
+    0,0,0,0,0,0,1,1,1,1,29,1,29,1,1,1,1,1,1,1,29,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,0,0,29,0,0,0,0,29,29,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,29,1,1,
+    1,1,1,1,1,1,1,1,0,0,29,0,0,0,0,29,0,0,0,0,0,29,0,29,29,29,0,0,0,0,0,0,
+    0,29,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+    0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,29,29,0,0,0,0,0,0,0,0,
+    0,18,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,18,1,1,1,1,
+    1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,1,1,1,1,
+    1,1,1,1,1,18,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,18,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,18,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,1,1,1,1,1,1,1,1,1,18,1,1,1,1,1,1,
+    0,0,0,0,0,0,0,0,0,18,1,1,1,1,1,1,1,1,1,18,1,1,1,1,1,1,0,1,29,29,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,21,21,21,21,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,21,21,21,21,21,21,21,21,5,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,5,21,21,17,17,17,17,17,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,5,5,5,5,5,
+    1,1,1,1,1,1,1,1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,29,
+    5,5,5,5,5,5,5,29,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,29,5,5,5,5,5,
+    5,5,29,5,5,29,5,5,5,5,5,29,29,29,29,29,5,5,5,5,5,5,5,3,3,3,3,3,3,3,29,29,
+    8,8,8,8,8,8,8,8,8,8,29,29,29,29,4,21,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,29,
+    4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,8,8,8,8,8,8,8,8,8,8,29,29,29,29,29,19,
+    4,4,4,4,4,4,4,29,4,4,4,4,29,4,4,29,4,4,4,4,4,29,29,10,10,10,10,10,10,10,10,10,
+    1,1,1,1,5,5,5,5,5,5,5,3,29,29,29,29,10,10,10,10,10,10,10,10,10,10,10,10,21,10,10,10,
+    19,10,10,10,10,29,29,29,29,29,29,29,29,29,29,29,10,10,10,10,10,10,10,10,10,10,10,10,10,10,21,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,29,29,4,4,4,4,29,4,4,4,4,4,4,4,4,4,4,4,
+    29,4,4,29,4,29,29,4,29,4,4,4,4,4,4,4,4,4,4,29,4,4,4,4,29,4,29,4,29,29,29,29,
+    29,29,4,29,29,29,29,4,29,4,29,4,29,4,4,4,29,4,4,29,4,29,29,4,29,4,29,4,29,4,29,4,
+    29,4,4,29,4,29,29,4,4,4,4,29,4,4,4,4,4,4,4,29,4,4,4,4,29,4,4,4,4,29,4,29,
+    4,4,4,4,4,4,4,4,4,4,29,4,4,4,4,4,29,4,4,4,29,4,4,4,4,4,29,4,4,4,4,4,
+    18,18,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,29,29,
+    29,29,29,29,29,29,21,21,21,21,21,21,21,21,21,21,21,21,21,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    21,21,21,21,21,21,21,21,21,29,29,29,29,29,29,29,21,21,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    21,21,21,21,21,21,21,21,21,21,21,20,20,20,20,20,21,21,21,21,21,21,21,21,29,29,29,29,29,21,21,21,
+    21,21,21,21,21,21,21,21,29,29,29,29,29,29,29,29,21,21,21,21,21,29,29,29,21,21,21,21,21,29,29,29,
+    21,21,21,29,21,21,21,21,21,21,21,21,21,21,21,21,29,26,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,28,28,28,28,28,28,28,28,28,28,28,28,28,28,29,29
+};
+
+#endif